@@ -0,0 +1,74 @@
+# locale_tables.cmake - Turns src/locales/*.json into constexpr string tables at configure time.
+#
+#   generated/locale_keys.h  enum class LocaleKey, one value per key of english.json, sorted by name
+#   generated/locale_data.h  kLocaleStrings_<lang>[LocaleKey::Count] for every language, plus kEmbeddedLocales
+#
+# A key missing from a translation is filled in with the English string here, so Locale::Get() is a plain array index
+# and never falls back at runtime. Keys that only exist in a translation are reported and dropped, since nothing can
+# look them up.
+
+function(generate_locale_tables _SOURCE_DIR _OUTPUT_DIR)
+    set(_LANGS ${ARGN})
+    set(_KEYS_HEADER "${_OUTPUT_DIR}/locale_keys.h")
+    set(_DATA_HEADER "${_OUTPUT_DIR}/locale_data.h")
+
+    file(READ "${_SOURCE_DIR}/english.json" _ENGLISH)
+    string(JSON _KEY_COUNT LENGTH "${_ENGLISH}")
+    math(EXPR _LAST_KEY "${_KEY_COUNT} - 1")
+
+    set(_KEYS "")
+    foreach(_INDEX RANGE ${_LAST_KEY})
+        string(JSON _KEY MEMBER "${_ENGLISH}" ${_INDEX})
+        if(NOT _KEY MATCHES "^[A-Za-z_][A-Za-z0-9_]*$")
+            message(FATAL_ERROR "Locale key \"${_KEY}\" in english.json is not a valid C++ identifier")
+        endif()
+        list(APPEND _KEYS "${_KEY}")
+    endforeach()
+
+    file(MAKE_DIRECTORY "${_OUTPUT_DIR}")
+
+    file(WRITE "${_KEYS_HEADER}" "// Auto-generated by CMake from src/locales/english.json — do not edit. Re-run cmake to refresh.\n#pragma once\n\n")
+    file(APPEND "${_KEYS_HEADER}" "enum class LocaleKey : unsigned short\n{\n")
+    foreach(_KEY ${_KEYS})
+        file(APPEND "${_KEYS_HEADER}" "    ${_KEY},\n")
+    endforeach()
+    file(APPEND "${_KEYS_HEADER}" "    Count\n};\n")
+
+    file(WRITE "${_DATA_HEADER}" "// Auto-generated by CMake from src/locales/*.json — do not edit. Re-run cmake to refresh.\n#pragma once\n\n")
+    file(APPEND "${_DATA_HEADER}" "#include <cstddef>\n#include <locale_keys.h>\n\n")
+
+    foreach(_LANG ${_LANGS})
+        file(READ "${_SOURCE_DIR}/${_LANG}.json" _JSON)
+
+        string(JSON _LANG_KEY_COUNT LENGTH "${_JSON}")
+        if(_LANG_KEY_COUNT GREATER 0)
+            math(EXPR _LAST_LANG_KEY "${_LANG_KEY_COUNT} - 1")
+            foreach(_INDEX RANGE ${_LAST_LANG_KEY})
+                string(JSON _KEY MEMBER "${_JSON}" ${_INDEX})
+                if(NOT _KEY IN_LIST _KEYS)
+                    message(WARNING "Locale key \"${_KEY}\" in ${_LANG}.json does not exist in english.json and is ignored")
+                endif()
+            endforeach()
+        endif()
+
+        # Each string is written as open, content, close appends so no CMake string processing touches the text
+        file(APPEND "${_DATA_HEADER}" "inline constexpr const char* kLocaleStrings_${_LANG}[static_cast<size_t>(LocaleKey::Count)] = {\n")
+        foreach(_KEY ${_KEYS})
+            string(JSON _VALUE ERROR_VARIABLE _MISSING GET "${_JSON}" "${_KEY}")
+            if(_MISSING)
+                string(JSON _VALUE GET "${_ENGLISH}" "${_KEY}")
+            endif()
+            file(APPEND "${_DATA_HEADER}" "    R\"__LD__(")
+            file(APPEND "${_DATA_HEADER}" "${_VALUE}")
+            file(APPEND "${_DATA_HEADER}" ")__LD__\",\n")
+        endforeach()
+        file(APPEND "${_DATA_HEADER}" "};\n\n")
+    endforeach()
+
+    file(APPEND "${_DATA_HEADER}" "struct EmbeddedLocale\n{\n    const char* id;\n    const char* const* strings;\n};\n\n")
+    file(APPEND "${_DATA_HEADER}" "inline constexpr EmbeddedLocale kEmbeddedLocales[] = {\n")
+    foreach(_LANG ${_LANGS})
+        file(APPEND "${_DATA_HEADER}" "    { \"${_LANG}\", kLocaleStrings_${_LANG} },\n")
+    endforeach()
+    file(APPEND "${_DATA_HEADER}" "};\n")
+endfunction()
@@ -36,7 +36,7 @@
 #include <i18n.h>
 #ifdef _WIN32
 #endif
-#include <format>
+#include <cstdio>
 #include <util.h>
 
 using namespace ImGui;
@@ -44,7 +44,7 @@ using namespace ImGui;
 constexpr const char* discordInviteLink = "https://steambrew.app/discord";
 constexpr const char* githubRepositoryUrl = "https://github.com/SteamClientHomebrew/Millennium";
 
-const void RenderBottomNavBar(const char* identifier, float xPos, std::function<void()> buttonRenderCallback, bool setPosManually)
+const void RenderBottomNavBar(const char* identifier, float xPos, FunctionRef<void()> buttonRenderCallback, bool setPosManually)
 {
     ImGuiIO& io = GetIO();
     ImGuiViewport* viewport = GetMainViewport();
@@ -59,19 +59,22 @@ const void RenderBottomNavBar(const char* identifier, float xPos, std::function<
     PushStyleVar(ImGuiStyleVar_ChildRounding, 0.0f);
     PushStyleColor(ImGuiCol_ChildBg, ImVec4(0.078f, 0.082f, 0.09f, 1.f));
 
-    BeginChild(std::format("##BottomNavBar{}", identifier).c_str(), ImVec2(viewport->Size.x, BottomNavBarHeight), true, ImGuiWindowFlags_NoScrollbar);
+    char childId[64];
+    snprintf(childId, sizeof(childId), "##BottomNavBar%s", identifier);
+
+    BeginChild(childId, ImVec2(viewport->Size.x, BottomNavBarHeight), true, ImGuiWindowFlags_NoScrollbar);
     {
         SetCursorPos({ ScaleX(45), GetCursorPosY() + ScaleY(12.5) });
-        Image((ImTextureID)(intptr_t)infoIconTexture, ImVec2(ScaleX(25), ScaleY(25)));
+        DrawIcon(Icon::Info, ImVec2(ScaleX(25), ScaleY(25)));
 
         SameLine(0, ScaleX(42));
         const float cursorPosSave = GetCursorPosX();
 
         SetCursorPosY(GetCursorPosY() - ScaleX(12));
-        TextColored(ImVec4(0.322f, 0.325f, 0.341f, 1.0f), "%s", Locale::Get("installerDisclaimer1"));
+        TextColored(ImVec4(0.322f, 0.325f, 0.341f, 1.0f), "%s", Locale::Get(LocaleKey::installerDisclaimer1));
 
         SetCursorPos({ cursorPosSave, GetCursorPosY() - ScaleY(20) });
-        TextColored(ImVec4(0.322f, 0.325f, 0.341f, 1.0f), "%s", Locale::Get("installerDisclaimer2"));
+        TextColored(ImVec4(0.322f, 0.325f, 0.341f, 1.0f), "%s", Locale::Get(LocaleKey::installerDisclaimer2));
 
         SameLine(0);
         SetCursorPosY(GetCursorPosY() - ScaleY(25));
@@ -81,10 +84,10 @@ const void RenderBottomNavBar(const char* identifier, float xPos, std::function<
         SetCursorPosX(xPos + GetCursorPosX() + GetContentRegionAvail().x - FooterContainerWidth);
         SetCursorPosY(GetCursorPosY() + ScaleY(10));
 
-        Image((ImTextureID)(intptr_t)discordIconTexture, ImVec2(ScaleX(30), ScaleY(30)));
+        DrawIcon(Icon::Discord, ImVec2(ScaleX(30), ScaleY(30)));
 
         static bool isDiscordButtonHovered = false;
-        float discordIconHoverTransparency = EaseInOutFloat(std::format("##DiscordIconHover{}", identifier).c_str(), 0.f, 1.f, isDiscordButtonHovered, 0.3f);
+        float discordIconHoverTransparency = EaseInOutFloat("##DiscordIconHover", 0.f, 1.f, isDiscordButtonHovered, 0.3f);
 
         /** Check if the animation has started */
         if (discordIconHoverTransparency != 0.f) {
@@ -97,7 +100,7 @@ const void RenderBottomNavBar(const char* identifier, float xPos, std::function<
             PushStyleVar(ImGuiStyleVar_WindowRounding, 6);
             PushStyleVar(ImGuiStyleVar_Alpha, discordIconHoverTransparency);
             PushStyleColor(ImGuiCol_PopupBg, ImVec4(0.098f, 0.102f, 0.11f, 1.0f));
-            SetTooltip("%s", Locale::Get("tooltipDiscord"));
+            SetTooltip("%s", Locale::Get(LocaleKey::tooltipDiscord));
 
             if (IsItemClicked()) {
                 OpenUrl(discordInviteLink);
@@ -112,10 +115,10 @@ const void RenderBottomNavBar(const char* identifier, float xPos, std::function<
         SameLine(0, ScaleX(25));
         SetCursorPosY(GetCursorPosY() - ScaleY(15));
 
-        Image((ImTextureID)(intptr_t)gtihubIconTexture, ImVec2(ScaleX(30), ScaleY(30)));
+        DrawIcon(Icon::Github, ImVec2(ScaleX(30), ScaleY(30)));
 
         static bool isGithubButtonHovered = false;
-        float githubIconHoverTransparency = EaseInOutFloat(std::format("##GithubIconHover{}", identifier).c_str(), 0.f, 1.f, isGithubButtonHovered, 0.3f);
+        float githubIconHoverTransparency = EaseInOutFloat("##GithubIconHover", 0.f, 1.f, isGithubButtonHovered, 0.3f);
 
         /** Check if the animation has started */
         if (githubIconHoverTransparency != 0.f) {
@@ -128,7 +131,7 @@ const void RenderBottomNavBar(const char* identifier, float xPos, std::function<
             PushStyleVar(ImGuiStyleVar_WindowRounding, 6);
             PushStyleVar(ImGuiStyleVar_Alpha, githubIconHoverTransparency);
             PushStyleColor(ImGuiCol_PopupBg, ImVec4(0.098f, 0.102f, 0.11f, 1.0f));
-            SetTooltip("%s", Locale::Get("tooltipGithub"));
+            SetTooltip("%s", Locale::Get(LocaleKey::tooltipGithub));
 
             if (IsItemClicked()) {
                 OpenUrl(githubRepositoryUrl);
@@ -114,7 +114,7 @@ bool ImGui::Checkbox(const char* label, bool* v)
     return pressed;
 }
 
-const CheckBoxState* RenderCheckBox(bool checked, std::string description, std::string tooltipText, bool disabled, bool endChild)
+const CheckBoxState* RenderCheckBox(bool checked, const std::string& description, const std::string& tooltipText, bool disabled, bool endChild)
 {
     static std::unordered_map<std::string, CheckBoxState> checkBoxStates;
     auto& state = checkBoxStates.try_emplace(description, checked).first->second;
@@ -143,14 +143,14 @@ const CheckBoxState* RenderCheckBox(bool checked, std::string description, std::
         SetCursorPosY(GetCursorPosY() + ScaleY(3));
         Text("%s", description.c_str());
     } else {
-        std::string checkBoxMessage = " " + std::string(description);
+        std::string checkBoxMessage = " " + description;
 
         Checkbox(checkBoxMessage.c_str(), &state.isChecked);
         EndDisabled();
     }
 
     if (!tooltipText.empty()) {
-        float autoUpdateColor = EaseInOutFloat(description, 0.f, 1.f, state.isHovered, 0.3f);
+        float autoUpdateColor = EaseInOutFloat(description.c_str(), 0.f, 1.f, state.isHovered, 0.3f);
 
         if (autoUpdateColor) {
             SetMouseCursor(ImGuiMouseCursor_Hand);
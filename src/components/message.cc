@@ -33,6 +33,8 @@
 #include <imgui.h>
 #include <dpi.h>
 #include <animate.h>
+#include <frame_scheduler.h>
+#include <ui_events.h>
 #include <imgui_internal.h>
 
 using namespace ImGui;
@@ -44,15 +46,27 @@ struct MessageBoxProps
     MessageLevel level;
 };
 
-std::queue<MessageBoxProps> messageBoxQueue;
+/** Only touched on the renderer thread; other threads reach it through UiEvents */
+static std::queue<MessageBoxProps> messageBoxQueue;
+static MessageBoxHandler messageBoxHandler;
+
+void SetMessageBoxHandler(MessageBoxHandler handler)
+{
+    messageBoxHandler = std::move(handler);
+}
 
 /**
  * Show a message box with the given title, body, and level.
- * The message box will be added to the queue and displayed when RenderMessageBoxes() is called.
+ * The message box will be added to the queue and displayed when RenderMessageBoxes() is called,
+ * unless a handler was installed with SetMessageBoxHandler(). Safe to call from any thread.
  */
 void ShowMessageBox(std::string title, std::string body, MessageLevel level)
 {
-    messageBoxQueue.push({ title, body, level });
+    if (messageBoxHandler) {
+        messageBoxHandler(title, body, level);
+        return;
+    }
+    UiEvents::Post([box = MessageBoxProps{ std::move(title), std::move(body), level }]() mutable { messageBoxQueue.push(std::move(box)); });
 }
 
 /**
@@ -114,6 +128,10 @@ void RenderMessageBoxes()
         scrollVelocity *= scrollFriction;
         scrollPosition += scrollVelocity;
 
+        if (std::abs(scrollVelocity) > minVelocityThreshold) {
+            FrameScheduler::RequestFrame();
+        }
+
         const auto cursorPos = GetCursorPosY();
 
         PushFont(io.Fonts->Fonts[1]);
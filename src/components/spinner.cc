@@ -0,0 +1,62 @@
+/**
+ * ==================================================
+ *   _____ _ _ _             _
+ *  |     |_| | |___ ___ ___|_|_ _ _____
+ *  | | | | | | | -_|   |   | | | |     |
+ *  |_|_|_|_|_|_|___|_|_|_|_|_|___|_|_|_|
+ *
+ * ==================================================
+ *
+ * Copyright (c) 2025 Project Millennium
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <components.h>
+#include <imgui.h>
+#include <imgui_internal.h>
+#include <imspinner.h>
+
+using namespace ImGui;
+
+/**
+ * Draw the spinning arc used while something loads.
+ * Same layout and motion as ImSpinner's e_st_ang with a transparent background, but its points are generated in place;
+ * ImSpinner routes every circle through a heap-allocated std::function, twice per frame per spinner.
+ */
+void RenderSpinner(const char* label, float radius, float thickness, const ImVec4& color, float speed, float angle)
+{
+    ImVec2 pos, size, centre;
+    int segmentCount;
+
+    if (!ImSpinner::detail::SpinnerBegin(label, radius, pos, size, centre, segmentCount)) {
+        return;
+    }
+
+    ImDrawList* drawList = GetWindowDrawList();
+    const float start = static_cast<float>(GetTime()) * speed;
+
+    drawList->PathClear();
+    for (int i = 0; i < segmentCount; i++) {
+        const float a = start + (i * angle / segmentCount);
+        drawList->PathLineTo(ImVec2(centre.x + ImCos(a) * radius, centre.y + ImSin(a) * radius));
+    }
+    /** GetColorU32 applies the style alpha, as ImSpinner does, so spinners fade with their panel */
+    drawList->PathStroke(GetColorU32(color), 0, thickness);
+}
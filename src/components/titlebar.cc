@@ -38,6 +38,7 @@
 #include <math.h>
 #include <worker.h>
 #include <renderer.h>
+#include <text_layout.h>
 #include <cstdlib>
 #include <format>
 #ifndef _WIN32
@@ -52,7 +53,7 @@ using namespace ImGui;
  */
 bool RenderTitleBarComponent(std::shared_ptr<RouterNav> router)
 {
-    const std::string strTitleText = Locale::Get("titlebarTitle");
+    const std::string strTitleText = Locale::Get(LocaleKey::titlebarTitle);
 
     ImGuiViewport* viewport = GetMainViewport();
     PushStyleVar(ImGuiStyleVar_WindowPadding, ImVec2(ScaleX(15), ScaleY(15)));
@@ -72,7 +73,7 @@ bool RenderTitleBarComponent(std::shared_ptr<RouterNav> router)
         BeginChild("##BackButtonChild", ImVec2(backButtonDim.x, backButtonDim.y), true, ImGuiWindowFlags_NoScrollbar);
         {
             SetCursorPos({ ScaleX(13), ScaleY(11) });
-            Image((ImTextureID)(intptr_t)backBtnTexture, { iconDimension, iconDimension });
+            DrawIcon(Icon::BackButton, { iconDimension, iconDimension });
         }
         PopStyleVar();
         EndChild();
@@ -88,7 +89,7 @@ bool RenderTitleBarComponent(std::shared_ptr<RouterNav> router)
             SetMouseCursor(ImGuiMouseCursor_Hand);
         }
 
-        Image((ImTextureID)(intptr_t)logoTexture, ImVec2(iconDimension, iconDimension));
+        DrawIcon(Icon::Logo, ImVec2(iconDimension, iconDimension));
 
         SameLine(0, titlePadding);
         SetCursorPosY(GetCursorPosY() + ScaleY(10));
@@ -117,7 +118,7 @@ bool RenderTitleBarComponent(std::shared_ptr<RouterNav> router)
         BeginChild("##LangButton", { langButtonDimensions.x, langButtonDimensions.y }, false, ImGuiWindowFlags_NoScrollbar);
         {
             SetCursorPos({ (langButtonDimensions.x - ScaleX(20)) * 0.5f, ScaleY(12) });
-            Image((ImTextureID)(intptr_t)languageIconTexture, { ScaleX(20), ScaleY(20) });
+            DrawIcon(Icon::Language, { ScaleX(20), ScaleY(20) });
         }
         EndChild();
 
@@ -177,6 +178,7 @@ bool RenderTitleBarComponent(std::shared_ptr<RouterNav> router)
                 }
                 if (Selectable(lang.displayName.c_str(), isSelected, 0, ImVec2(popupWidth, 0))) {
                     Locale::SetLanguage(lang.id);
+                    TextLayout::Invalidate();
                     RequestFontRebuild();
                     CloseCurrentPopup();
                 }
@@ -204,7 +206,7 @@ bool RenderTitleBarComponent(std::shared_ptr<RouterNav> router)
         BeginChild("##CloseButton", { closeButtonDimensions.x, closeButtonDimensions.y }, true, ImGuiWindowFlags_NoScrollbar);
         {
             SetCursorPos({ ScaleX(25), ScaleY(12) });
-            Image((ImTextureID)(intptr_t)closeButtonTexture, { closeButtonDim, closeButtonDim });
+            DrawIcon(Icon::CloseButton, { closeButtonDim, closeButtonDim });
         }
         PopStyleVar();
         EndChild();
@@ -0,0 +1,119 @@
+/**
+ * ==================================================
+ *   _____ _ _ _             _
+ *  |     |_| | |___ ___ ___|_|_ _ _____
+ *  | | | | | | | -_|   |   | | | |     |
+ *  |_|_|_|_|_|_|___|_|_|_|_|_|___|_|_|_|
+ *
+ * ==================================================
+ *
+ * Copyright (c) 2025 Project Millennium
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <imgui.h>
+#include <dpi.h>
+#include <components.h>
+#include <animate.h>
+#include <i18n.h>
+#include <worker.h>
+#include <updater.h>
+#include <cstdio>
+
+using namespace ImGui;
+
+/**
+ * Render the banner announcing a downloaded installer update.
+ * It floats under the title bar rather than interrupting with a modal, since the download finished on its own and the
+ * user may be halfway through an install. Restarting is held back while a worker is busy, like closing the window.
+ */
+void RenderUpdateNotice()
+{
+    const bool isVisible = Updater::GetStatus() == Updater::Status::ReadyToRestart && !Updater::IsDismissed();
+    const float opacityAnimation = EaseInOutFloat("##UpdateNoticeAnimation", 0.f, 1.f, isVisible, 0.3f);
+
+    if (opacityAnimation <= 0.01f) {
+        return;
+    }
+
+    ImGuiViewport* viewport = GetMainViewport();
+    SetNextWindowPos(ImVec2(viewport->Pos.x + viewport->Size.x / 2, viewport->Pos.y + ScaleY(85)), ImGuiCond_Always, ImVec2(0.5f, 0.f));
+
+    PushStyleColor(ImGuiCol_WindowBg, ImVec4(0.067f, 0.071f, 0.078f, 1.0f));
+    PushStyleColor(ImGuiCol_Border, ImVec4(0.48f, 0.484f, 0.492f, 0.3f));
+    PushStyleVar(ImGuiStyleVar_Alpha, opacityAnimation);
+    PushStyleVar(ImGuiStyleVar_WindowRounding, ScaleX(10.0f));
+    PushStyleVar(ImGuiStyleVar_WindowBorderSize, ScaleX(1.0f));
+    PushStyleVar(ImGuiStyleVar_WindowPadding, ImVec2(ScaleX(15), ScaleY(10)));
+
+    Begin("##UpdateNotice", nullptr,
+          ImGuiWindowFlags_NoDecoration | ImGuiWindowFlags_AlwaysAutoResize | ImGuiWindowFlags_NoMove | ImGuiWindowFlags_NoSavedSettings | ImGuiWindowFlags_NoFocusOnAppearing |
+              ImGuiWindowFlags_NoNav);
+    {
+        const ImVec2 buttonSize = { ScaleX(100), ScaleY(35) };
+
+        char message[256];
+        snprintf(message, sizeof(message), Locale::Get(LocaleKey::updateReady), Updater::GetAvailableVersion().c_str());
+
+        SetCursorPosY(GetCursorPosY() + (buttonSize.y - GetTextLineHeight()) / 2);
+        Text("%s", message);
+        SameLine(0, ScaleX(20));
+        SetCursorPosY(GetCursorPosY() - (buttonSize.y - GetTextLineHeight()) / 2);
+
+        PushStyleColor(ImGuiCol_Button, ImVec4(0.f, 0.f, 0.f, 0.f));
+        PushStyleColor(ImGuiCol_ButtonHovered, ImVec4(0.16f, 0.16f, 0.16f, 1.f));
+        PushStyleColor(ImGuiCol_ButtonActive, ImVec4(0.2f, 0.2f, 0.2f, 1.f));
+
+        if (Button(Locale::Get(LocaleKey::updateLater), buttonSize)) {
+            Updater::Dismiss();
+        }
+
+        if (IsItemHovered()) {
+            SetMouseCursor(ImGuiMouseCursor_Hand);
+        }
+
+        PopStyleColor(3);
+        SameLine(0, ScaleX(10));
+
+        const bool isWorkerBusy = IsWorkerBusy();
+
+        PushStyleColor(ImGuiCol_Button, ImVec4(1.f, 1.f, 1.f, 1.f));
+        PushStyleColor(ImGuiCol_ButtonHovered, ImVec4(1.f, 1.f, 1.f, 1.f));
+        PushStyleColor(ImGuiCol_ButtonActive, ImVec4(0.9f, 0.9f, 0.9f, 1.f));
+        PushStyleColor(ImGuiCol_Text, ImVec4(0.f, 0.f, 0.f, 1.f));
+        BeginDisabled(isWorkerBusy || !isVisible);
+
+        if (Button(Locale::Get(LocaleKey::updateRestart), buttonSize)) {
+            Updater::RestartIntoUpdate();
+        }
+
+        EndDisabled();
+
+        if (IsItemHovered(ImGuiHoveredFlags_AllowWhenDisabled)) {
+            SetMouseCursor(isWorkerBusy ? ImGuiMouseCursor_NotAllowed : ImGuiMouseCursor_Hand);
+        }
+
+        PopStyleColor(4);
+    }
+    End();
+
+    PopStyleColor(2);
+    PopStyleVar(4);
+}
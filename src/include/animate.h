@@ -33,25 +33,29 @@
 #include <router.h>
 #include <memory>
 #include <dpi.h>
+#include <imgui.h>
 
 // Easing function: ease-in-out quadratic
 float EaseInOut(float t);
 float EaseInOutTime(float t, float b, float c, float d);
 
-struct AnimationState
-{
-    float currentPosY;
-    float startPosY;
-    float elapsedTime;
-    bool isAnimating;
-    bool wasHovered;
+/**
+ * Animation state is keyed by ImGuiID and lives in flat tables owned by the renderer thread, so none of these may be
+ * called from another thread. The `const char*` overloads hash the label against the ID stack like any ImGui widget,
+ * so the same label in two windows animates independently.
+ */
+float SmoothFloat(ImGuiID id, float targetOffset, bool currentState, float displacement, float duration,
+                  std::tuple<float, float> colorTransition = std::make_tuple(0.f, 0.f));
+float SmoothFloat(const char* id, float targetOffset, bool currentState, float displacement, float duration,
+                  std::tuple<float, float> colorTransition = std::make_tuple(0.f, 0.f));
 
-    float lastXDPI = XDPI, lastYDPI = YDPI;
-};
+float EaseInOutFloat(ImGuiID id, float lowerBound, float upperBound, bool currentState, float duration);
+float EaseInOutFloat(const char* id, float lowerBound, float upperBound, bool currentState, float duration);
 
-float SmoothFloat(const std::string& id, float targetOffset, bool currentState, float displacement, float duration,
-                  std::tuple<float, float> colorTransition = std::make_tuple(0.f, 0.f));
+/** Step every running animation by `deltaTime`, once per frame. Returns whether any is still in motion. */
+bool AdvanceAnimations(float deltaTime);
 
-float EaseInOutFloat(const std::string& id, float lowerBound, float upperBound, bool currentState, float duration);
+/** How many animations were still in motion after the last AdvanceAnimations(). */
+size_t ActiveAnimationCount();
 
-float EaseOutBack(float t, float b, float c, float d, float overshoot = 1.20158f);
\ No newline at end of file
+float EaseOutBack(float t, float b, float c, float d, float overshoot = 1.20158f);
@@ -0,0 +1,71 @@
+/**
+ * ==================================================
+ *   _____ _ _ _             _
+ *  |     |_| | |___ ___ ___|_|_ _ _____
+ *  | | | | | | | -_|   |   | | | |     |
+ *  |_|_|_|_|_|_|___|_|_|_|_|_|___|_|_|_|
+ *
+ * ==================================================
+ *
+ * Copyright (c) 2025 Project Millennium
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <string>
+
+/**
+ * Content-addressed cache of downloaded release archives, keyed by their sha256 digest.
+ *
+ * Entries are stored as <cache dir>/<hex digest>. A cache hit lets the installer skip the network entirely
+ * when reinstalling, repairing, or switching back to a previously installed version. Entry modification times
+ * are bumped on every hit, and the least recently used entries are evicted once the cache grows past its size cap.
+ */
+namespace ArchiveCache
+{
+/** Releases are a few tens of MB, this keeps roughly a dozen versions around. */
+static constexpr uintmax_t DEFAULT_SIZE_LIMIT = 512ull * 1024 * 1024;
+
+/** Per-user cache directory, %LOCALAPPDATA%\MillenniumInstaller\cache on Windows and $XDG_CACHE_HOME/millennium-installer elsewhere. */
+std::filesystem::path GetDirectory();
+
+/**
+ * Look up a cached archive.
+ * @param sha256Hex The lowercase hex sha256 digest of the archive.
+ * @return The cached file, or std::nullopt on a miss. The entry is marked as recently used.
+ * @note The caller is still expected to verify the digest, a cached file may have been tampered with or truncated.
+ */
+std::optional<std::filesystem::path> Lookup(const std::string& sha256Hex);
+
+/**
+ * Move a verified archive into the cache, then evict old entries.
+ * @return The path of the cached entry, or std::nullopt if the cache isn't writable (the source file is left untouched).
+ */
+std::optional<std::filesystem::path> Store(const std::filesystem::path& file, const std::string& sha256Hex);
+
+/** Drop a single entry, e.g. after it failed verification. */
+void Remove(const std::string& sha256Hex);
+
+/** Evict least recently used entries until the cache is at most maxBytes. */
+void Evict(uintmax_t maxBytes = DEFAULT_SIZE_LIMIT);
+} // namespace ArchiveCache
@@ -0,0 +1,84 @@
+/**
+ * ==================================================
+ *   _____ _ _ _             _
+ *  |     |_| | |___ ___ ___|_|_ _ _____
+ *  | | | | | | | -_|   |   | | | |     |
+ *  |_|_|_|_|_|_|___|_|_|_|_|_|___|_|_|_|
+ *
+ * ==================================================
+ *
+ * Copyright (c) 2025 Project Millennium
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+#include <cstddef>
+#include <span>
+
+/**
+ * Fonts and images embedded at build time by tools/embed_assets.cc from resources/static.
+ * Every asset lives once, in the generated assets.cc. Images are decoded to RGBA8 at build
+ * time; fonts and the window icons are stored zlib-compressed and inflated on first use.
+ */
+namespace Assets
+{
+/** Order matches the embed_assets arguments in CMakeLists.txt; the generated source asserts it. */
+enum class Id
+{
+    GeistVariable,
+    GeistBold,
+    WindowIconDark,
+    WindowIconLight,
+    IconAtlas,
+    Count
+};
+
+struct Embedded
+{
+    const unsigned char* data;
+    size_t storedSize;
+    size_t size;
+    int width;
+    int height;
+    bool compressed;
+};
+
+extern const Embedded EMBEDDED[];
+
+struct Image
+{
+    const unsigned char* pixels;
+    int width;
+    int height;
+};
+
+/**
+ * Get the bytes of an embedded asset. Compressed assets are inflated the first time they are
+ * requested and kept for the lifetime of the process, so the span stays valid. Thread-safe.
+ * @return The asset, or an empty span if it could not be inflated.
+ */
+std::span<const unsigned char> Get(Id id);
+
+/**
+ * Get an embedded image as RGBA8 pixels.
+ * @return The image, with null pixels if it could not be inflated.
+ */
+Image GetImage(Id id);
+} // namespace Assets
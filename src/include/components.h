@@ -31,7 +31,11 @@
 #pragma once
 
 #include <memory>
+#include <string>
+#include <vector>
 #include <router.h>
+#include <function_ref.h>
+#include <imgui.h>
 #include <nlohmann/json.hpp>
 
 bool RenderTitleBarComponent(std::shared_ptr<RouterNav> router);
@@ -40,11 +44,38 @@ const void RenderInstallPrompt(std::shared_ptr<RouterNav> router, float xPos);
 const void RenderInstaller(std::shared_ptr<RouterNav> router, float xPos);
 const void RenderUninstallSelect(std::shared_ptr<RouterNav> router, float xPos);
 
-const void RenderBottomNavBar(const char* identifier, float xPos, std::function<void()> buttonRenderCallback, bool setPosManually = false);
+const void RenderBottomNavBar(const char* identifier, float xPos, FunctionRef<void()> buttonRenderCallback, bool setPosManually = false);
+
+/** Spinning arc shown while something loads; drawn in place so it never allocates. */
+void RenderSpinner(const char* label, float radius, float thickness, const ImVec4& color, float speed = 6.0f, float angle = 3.14159265f);
 
 void StartInstaller(std::string steamPath, nlohmann::json releaseInfo, nlohmann::json osReleaseInfo);
+
+/** Download and verify the release once, then extract it into every Steam root concurrently. */
+void StartInstaller(std::vector<std::string> steamPaths, nlohmann::json releaseInfo, nlohmann::json osReleaseInfo);
+
+struct InstallTarget
+{
+    std::string steamPath;
+    double progress = 0.0;
+    bool finished = false;
+    bool success = false;
+    std::string message;
+};
+
+/** Snapshot of the per-target state of the current (or last) install. */
+std::vector<InstallTarget> GetInstallTargets();
+
+/** Whether the sha256 of `file` matches `expectedHex`, the hex part of a GitHub asset "sha256:<hex>" digest. */
+bool VerifyDownloadSignature(const std::string& file, const std::string& expectedHex);
 void InitializeUninstaller();
+/** Renderer thread: stop sizing the uninstall components, e.g. once the user has left the uninstall page. */
+void CancelUninstallerScan();
 const bool FetchVersionInfo();
+const bool SelectReleaseByTag(const std::string& tag);
+
+/** Release chosen by FetchVersionInfo()/SelectReleaseByTag(), and its asset for the current platform. */
+extern nlohmann::json selectedRelease, osReleaseInfo;
 
 enum MessageLevel
 {
@@ -56,6 +87,14 @@ enum MessageLevel
 void ShowMessageBox(std::string title, std::string body, MessageLevel level);
 void RenderMessageBoxes();
 
+/** Offer to restart into a background-downloaded installer update, once one is staged. */
+void RenderUpdateNotice();
+
+using MessageBoxHandler = std::function<void(const std::string& title, const std::string& body, MessageLevel level)>;
+
+/** Route message boxes somewhere other than the on-screen queue, e.g. stdout in headless mode. */
+void SetMessageBoxHandler(MessageBoxHandler handler);
+
 struct CheckBoxState
 {
     bool isHovered;
@@ -67,4 +106,4 @@ struct CheckBoxState
     }
 };
 
-const CheckBoxState* RenderCheckBox(bool checked, std::string description, std::string tooltipText = nullptr, bool disabled = false, bool endChild = false);
\ No newline at end of file
+const CheckBoxState* RenderCheckBox(bool checked, const std::string& description, const std::string& tooltipText = {}, bool disabled = false, bool endChild = false);
\ No newline at end of file
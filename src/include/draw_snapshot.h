@@ -0,0 +1,81 @@
+/**
+ * ==================================================
+ *   _____ _ _ _             _
+ *  |     |_| | |___ ___ ___|_|_ _ _____
+ *  | | | | | | | -_|   |   | | | |     |
+ *  |_|_|_|_|_|_|___|_|_|_|_|_|___|_|_|_|
+ *
+ * ==================================================
+ *
+ * Copyright (c) 2025 Project Millennium
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+#include <imgui.h>
+#include <vector>
+
+/**
+ * A copy of the geometry one piece of UI produced in a frame, which can be appended to later frames' draw lists at a
+ * horizontal offset instead of running the code that built it again.
+ *
+ * Recording covers everything drawn into the current window between begin() and end(), plus the child windows begun in
+ * between. Anything that can't be replayed faithfully (popups, tooltips, draw callbacks) makes end() fail, and the
+ * caller keeps drawing that UI live. Replays stop succeeding once the font atlas texture changes.
+ *
+ * @note Renderer thread only.
+ */
+class DrawSnapshot
+{
+  public:
+    /** Start recording into the current window. */
+    void begin();
+
+    /** Stop recording. Returns false if the recorded UI can't be replayed. */
+    bool end();
+
+    /** Append the recording to the current window's draw list, shifted `xOffset` pixels right. Returns false if it is stale. */
+    bool replay(float xOffset) const;
+
+    void clear();
+
+  private:
+    struct Segment
+    {
+        ImVec4 clipRect;
+        ImTextureRef texture;
+        unsigned int firstVertex;
+        unsigned int vertexCount;
+        unsigned int firstIndex;
+        unsigned int indexCount;
+    };
+
+    bool recordCommands(const ImDrawList* source, int startCommand, unsigned int startIndex);
+
+    std::vector<ImDrawVert> vertices;
+    std::vector<ImDrawIdx> indices;
+    std::vector<Segment> segments;
+
+    ImDrawList* drawList = nullptr;
+    ImTextureData* fontTexture = nullptr;
+    int firstCommand = 0;
+    unsigned int firstIndex = 0;
+    int firstWindowOrder = 0;
+};
@@ -0,0 +1,62 @@
+/**
+ * ==================================================
+ *   _____ _ _ _             _
+ *  |     |_| | |___ ___ ___|_|_ _ _____
+ *  | | | | | | | -_|   |   | | | |     |
+ *  |_|_|_|_|_|_|___|_|_|_|_|_|___|_|_|_|
+ *
+ * ==================================================
+ *
+ * Copyright (c) 2025 Project Millennium
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+#include <cstddef>
+
+struct ImFontAtlas;
+
+/**
+ * On-disk cache of rasterized glyphs, so warm launches don't pay FreeType for text they have already drawn.
+ *
+ * The font atlas bakes glyphs lazily, one size at a time, as text is first drawn. Every glyph baked so far is written
+ * out together with its pixels, keyed by a fingerprint of the font sources (data, sizes, ranges, loader flags and
+ * rasterizer settings). On the next launch with the same fingerprint the file is memory mapped and its glyphs are
+ * packed straight into the atlas; anything missing from the cache still bakes lazily as before.
+ */
+namespace FontCache
+{
+/** Caches for other scale factors and languages are kept around, up to this many files. */
+static constexpr size_t MAX_ENTRIES = 4;
+
+/**
+ * Restore cached glyphs into the atlas.
+ * @note Renderer thread only. Call after the fonts have been added and the renderer backend is initialized,
+ * otherwise the atlas falls back to preloading every glyph range up front.
+ * @return The number of glyphs restored.
+ */
+size_t Load(ImFontAtlas* atlas);
+
+/** Write every glyph baked so far, if anything was baked since the last load or save. Renderer thread only. */
+bool Save(ImFontAtlas* atlas);
+
+/** Called once per frame; saves once newly baked glyphs have settled for a moment. */
+void Update(ImFontAtlas* atlas);
+} // namespace FontCache
@@ -0,0 +1,51 @@
+/**
+ * ==================================================
+ *   _____ _ _ _             _
+ *  |     |_| | |___ ___ ___|_|_ _ _____
+ *  | | | | | | | -_|   |   | | | |     |
+ *  |_|_|_|_|_|_|___|_|_|_|_|_|___|_|_|_|
+ *
+ * ==================================================
+ *
+ * Copyright (c) 2025 Project Millennium
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+#include <string>
+
+/**
+ * Resolves system font files for a language tag, the in-process equivalent of `fc-match :lang=<tag>` and `fc-list :lang=<tag>`.
+ *
+ * Queries go straight to libfontconfig when the build found it (HAVE_FONTCONFIG), otherwise to the fc-match / fc-list command
+ * line tools. Every answer, including "nothing found", is memoized for the lifetime of the process, so switching back and forth
+ * between languages only ever pays for the first lookup. Safe to call from any thread; always empty on Windows.
+ *
+ * Setting MILLENNIUM_FONT_RESOLVER=popen forces the command line tools, to compare the two paths. Each uncached lookup
+ * is logged with its duration.
+ */
+namespace FontResolver
+{
+/** The font fontconfig would pick for the language. Generic Latin fallbacks (DejaVu, Liberation, FreeSans) count as no match. */
+std::string Match(const std::string& langTag);
+
+/** The first installed font that declares coverage for the language; unlike Match() this never falls back to a Latin font. */
+std::string ListFirst(const std::string& langTag);
+} // namespace FontResolver
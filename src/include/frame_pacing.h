@@ -0,0 +1,56 @@
+/**
+ * ==================================================
+ *   _____ _ _ _             _
+ *  |     |_| | |___ ___ ___|_|_ _ _____
+ *  | | | | | | | -_|   |   | | | |     |
+ *  |_|_|_|_|_|_|___|_|_|_|_|_|___|_|_|_|
+ *
+ * ==================================================
+ *
+ * Copyright (c) 2025 Project Millennium
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+struct GLFWwindow;
+
+/**
+ * Paces the frames the renderer does draw (see FrameScheduler for when it draws at all).
+ *
+ * Frames are paced to the refresh rate of the monitor the window is on. Vsync is requested with glfwSwapInterval;
+ * the first few frames measure whether the driver actually honours it, and if not, a hybrid sleep-then-spin timer
+ * takes over. The timer learns how much the OS oversleeps and only spins for that final slice, so it never needs a
+ * global timer-resolution change.
+ */
+namespace FramePacing
+{
+/** Record the refresh rate of the monitor the window is on. Called from the main thread, read by the renderer. */
+void SetRefreshRate(int hz);
+
+/** Renderer thread, with the GL context current: request vsync and start calibrating. */
+void Initialize(GLFWwindow* window);
+
+/** Mark the start of a frame, after the renderer was woken up. */
+void BeginFrame();
+
+/** Mark the end of a frame (after glfwSwapBuffers) and wait out the rest of the frame period if vsync didn't. */
+void EndFrame();
+} // namespace FramePacing
@@ -0,0 +1,53 @@
+/**
+ * ==================================================
+ *   _____ _ _ _             _
+ *  |     |_| | |___ ___ ___|_|_ _ _____
+ *  | | | | | | | -_|   |   | | | |     |
+ *  |_|_|_|_|_|_|___|_|_|_|_|_|___|_|_|_|
+ *
+ * ==================================================
+ *
+ * Copyright (c) 2025 Project Millennium
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+/**
+ * Decides when the renderer thread draws a frame.
+ *
+ * Nothing is drawn while the UI is static; the renderer sleeps until something posts a wake. Input (via the main
+ * thread's event loop), message boxes and background work post wakes, and anything that animates (easing, spinners,
+ * route transitions, progress bars) asks for the next frame while it is in motion.
+ */
+namespace FrameScheduler
+{
+/** Draw at least a few more frames, enough for ImGui to settle hover and click state. Safe to call from any thread. */
+void RequestFrame();
+
+/** Draw continuously for the next `seconds`, e.g. to cover tooltip delays after input. Safe to call from any thread. */
+void KeepAlive(double seconds);
+
+/** Called by the main thread after every batch of window events. */
+void NotifyInput();
+
+/** Renderer thread: block until a frame is due. */
+void WaitForFrame();
+} // namespace FrameScheduler
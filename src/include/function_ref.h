@@ -0,0 +1,61 @@
+/**
+ * ==================================================
+ *   _____ _ _ _             _
+ *  |     |_| | |___ ___ ___|_|_ _ _____
+ *  | | | | | | | -_|   |   | | | |     |
+ *  |_|_|_|_|_|_|___|_|_|_|_|_|___|_|_|_|
+ *
+ * ==================================================
+ *
+ * Copyright (c) 2025 Project Millennium
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+template <typename Signature> class FunctionRef;
+
+/**
+ * Non-owning reference to a callable, for callbacks that only run while the call they're passed to is on the stack.
+ * Unlike std::function it never allocates, so UI code drawn every frame can hand over capturing lambdas for free.
+ */
+template <typename Result, typename... Args> class FunctionRef<Result(Args...)>
+{
+  public:
+    template <typename Callable>
+        requires(!std::is_same_v<std::remove_cvref_t<Callable>, FunctionRef> && std::is_invocable_r_v<Result, Callable&, Args...>)
+    FunctionRef(Callable&& callable)
+        : m_callable(const_cast<void*>(static_cast<const void*>(std::addressof(callable)))),
+          m_invoke([](void* target, Args... args) -> Result { return (*static_cast<std::remove_reference_t<Callable>*>(target))(std::forward<Args>(args)...); })
+    {
+    }
+
+    Result operator()(Args... args) const
+    {
+        return m_invoke(m_callable, std::forward<Args>(args)...);
+    }
+
+  private:
+    void* m_callable;
+    Result (*m_invoke)(void*, Args...);
+};
@@ -0,0 +1,62 @@
+/**
+ * ==================================================
+ *   _____ _ _ _             _
+ *  |     |_| | |___ ___ ___|_|_ _ _____
+ *  | | | | | | | -_|   |   | | | |     |
+ *  |_|_|_|_|_|_|___|_|_|_|_|_|___|_|_|_|
+ *
+ * ==================================================
+ *
+ * Copyright (c) 2025 Project Millennium
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+#include <optional>
+#include <string>
+#include <vector>
+
+/**
+ * Unattended command-line install, for imaging machines without clicking through the window.
+ *
+ *   Installer --headless [--steam-path <dir>]... [--tag <release>] [--start-steam] [--release-source=<url>]... [--trace[=file]]
+ *
+ * --steam-path may be repeated to install into several Steam roots at once; the release is downloaded
+ * and verified once and extracted into each root concurrently. GLFW, OpenGL and fonts are never initialized. Progress is streamed to stdout as one JSON object per line.
+ */
+struct HeadlessOptions
+{
+    std::vector<std::string> steamPaths; // empty uses the detected Steam installation
+    std::string releaseTag; // empty selects the latest stable release
+    bool startSteam = false;
+};
+
+/**
+ * Parse the headless options from the command line.
+ * @return std::nullopt when --headless is not present, in which case the regular window should be shown.
+ * @note Exits the process with code 2 if --headless is present but the remaining arguments are invalid.
+ */
+std::optional<HeadlessOptions> ParseHeadlessOptions(int argc, char** argv);
+
+/**
+ * Run the same download + install pipeline the UI uses.
+ * @return The process exit code, 0 on success.
+ */
+int RunHeadlessInstall(const HeadlessOptions& options);
@@ -37,6 +37,7 @@
 #include <iostream>
 #include <format>
 #include <nlohmann/json.hpp>
+#include <trace.h>
 #include "components.h"
 
 static size_t WriteByteCallback(char* ptr, size_t size, size_t nmemb, std::string* data)
@@ -176,6 +177,7 @@ struct Response
 
 static Response GetEx(const char* url, int maxRetries = 3, int timeoutSeconds = 30)
 {
+    TRACE_SCOPE("Http::GetEx", "http", url);
     Response result;
     CURL* curl = curl_easy_init();
 
@@ -228,6 +230,7 @@ struct ProgressData
     std::function<void(double, double)> progressCallback;
     std::chrono::time_point<std::chrono::steady_clock> lastUpdateTime;
     bool showProgress;
+    curl_off_t resumeOffset = 0; // bytes already on disk when the transfer was resumed
 };
 
 // File write data structure
@@ -248,9 +251,9 @@ static int xferInfoCallback(void* clientp, curl_off_t dltotal, curl_off_t dlnow,
 {
     ProgressData* prog = static_cast<ProgressData*>(clientp);
 
-    // Use provided file size if dltotal is 0 (unknown)
-    double total = (dltotal > 0) ? static_cast<double>(dltotal) : prog->fileSize;
-    double downloaded = static_cast<double>(dlnow);
+    // Use provided file size if dltotal is 0 (unknown). After a resume libcurl only counts the remaining bytes.
+    double total = (dltotal > 0) ? static_cast<double>(dltotal + prog->resumeOffset) : prog->fileSize;
+    double downloaded = static_cast<double>(dlnow + prog->resumeOffset);
 
     // Call the user-provided progress callback
     auto now = std::chrono::steady_clock::now();
@@ -269,23 +272,32 @@ static int xferInfoCallback(void* clientp, curl_off_t dltotal, curl_off_t dlnow,
  * @param fileSize Expected file size (in bytes) if known, otherwise 0
  * @param progressCallback Optional callback to track download progress
  * @param showProgress Whether to show progress (true by default)
+ * @param showErrors Whether to report failures with a message box (true by default)
  *
  * @return true if download was successful, false otherwise
+ * @note Interrupted transfers are resumed from the last byte written, as long as the server honours Range requests.
  */
 static bool downloadFile(const std::string& url, const std::string& outputPath, double fileSize = 0, std::function<void(double, double)> progressCallback = nullptr,
-                         bool showProgress = true)
+                         bool showProgress = true, bool showErrors = true)
 {
+    constexpr int MAX_ATTEMPTS = 3;
+
+    TRACE_SCOPE("Http::downloadFile", "http", url);
     CURL* curl = curl_easy_init();
     if (!curl) {
         std::cerr << "Failed to initialize curl" << std::endl;
-        ShowMessageBox("Whoops!", "Failed to initialize CURL to download Millennium!", Error);
+        if (showErrors) {
+            ShowMessageBox("Whoops!", "Failed to initialize CURL to download Millennium!", Error);
+        }
         return false;
     }
 
     FILE* fp = fopen(outputPath.c_str(), "wb");
     if (!fp) {
         std::cerr << "Failed to open output file: " << outputPath << std::endl;
-        ShowMessageBox("Whoops!", std::format("Failed to open file to write Millennium into: '{}'", outputPath), Error);
+        if (showErrors) {
+            ShowMessageBox("Whoops!", std::format("Failed to open file to write Millennium into: '{}'", outputPath), Error);
+        }
         curl_easy_cleanup(curl);
         return false;
     }
@@ -306,9 +318,26 @@ static bool downloadFile(const std::string& url, const std::string& outputPath,
     curl_easy_setopt(curl, CURLOPT_MAXREDIRS, 10L);
     curl_easy_setopt(curl, CURLOPT_TIMEOUT, 0L);
     curl_easy_setopt(curl, CURLOPT_CONNECTTIMEOUT, 10L);
-    curl_easy_setopt(curl, CURLOPT_ACCEPT_ENCODING, "");
+    /** No content coding: resume offsets come from the bytes on disk, and a Range is counted in bytes as sent */
+    curl_easy_setopt(curl, CURLOPT_ACCEPT_ENCODING, nullptr);
+
+    CURLcode res = CURLE_OK;
+    for (int attempt = 1; attempt <= MAX_ATTEMPTS; attempt++) {
+        res = curl_easy_perform(curl);
+
+        const bool isResumable = res == CURLE_PARTIAL_FILE || res == CURLE_RECV_ERROR || res == CURLE_SEND_ERROR;
+        if (!isResumable || attempt == MAX_ATTEMPTS) {
+            break;
+        }
 
-    CURLcode res = curl_easy_perform(curl);
+        fflush(fp);
+        const curl_off_t offset = static_cast<curl_off_t>(ftell(fp));
+        std::cerr << "[http] download interrupted (" << curl_easy_strerror(res) << "), resuming from byte " << offset << std::endl;
+
+        progressData.resumeOffset = offset;
+        curl_easy_setopt(curl, CURLOPT_RESUME_FROM_LARGE, offset);
+        std::this_thread::sleep_for(std::chrono::milliseconds(250 * attempt));
+    }
 
     long httpCode = 0;
     if (res == CURLE_HTTP_RETURNED_ERROR || res == CURLE_OK) {
@@ -349,7 +378,10 @@ static bool downloadFile(const std::string& url, const std::string& outputPath,
             break;
         }
 
-        ShowMessageBox("Whoops!", std::format("Failed to download file.\n\n{}", reason), Error);
+        std::cerr << "[http] download of " << url << " failed: " << reason << std::endl;
+        if (showErrors) {
+            ShowMessageBox("Whoops!", std::format("Failed to download file.\n\n{}", reason), Error);
+        }
         return false;
     }
     return true;
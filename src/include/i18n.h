@@ -1,6 +1,7 @@
 #pragma once
 #include <string>
 #include <vector>
+#include <locale_keys.h>       // generated by CMake from src/locales/english.json
 
 class Locale {
 public:
@@ -12,14 +13,14 @@ public:
     /** Detect system language, load translations, set current language. */
     static void Initialize();
 
-    /** Switch to a different language at runtime. */
+    /** Switch to a different language at runtime. Only swaps which string table Get() reads. */
     static void SetLanguage(const std::string& langId);
 
     /** Returns e.g. "russian", "english". */
     static const std::string& GetCurrentLanguageId();
 
-    /** Look up a translated string. Falls back to English if key/lang not found. */
-    static const char* Get(const std::string& key);
+    /** Look up a translated string. Keys a language lacks were filled with English at build time. */
+    static const char* Get(LocaleKey key);
 
     /** All available languages for the selector dropdown. */
     static const std::vector<Language>& GetAvailableLanguages();
@@ -30,6 +31,12 @@ public:
     /** True if current language uses CJK (Chinese/Japanese/Korean). */
     static bool UsesCJK();
 
+    /**
+     * Every codepoint a language's translations can display, English fallbacks included. Sorted and unique.
+     * Reads only the embedded locale data, so it is safe to call off the UI thread.
+     */
+    static std::vector<char32_t> GetCodepoints(const std::string& langId);
+
 private:
     static std::string DetectSystemLanguage();
 };
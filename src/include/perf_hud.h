@@ -0,0 +1,65 @@
+/**
+ * ==================================================
+ *   _____ _ _ _             _
+ *  |     |_| | |___ ___ ___|_|_ _ _____
+ *  | | | | | | | -_|   |   | | | |     |
+ *  |_|_|_|_|_|_|___|_|_|_|_|_|___|_|_|_|
+ *
+ * ==================================================
+ *
+ * Copyright (c) 2025 Project Millennium
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+struct ImDrawData;
+
+/**
+ * Per-frame cost of the render loop: CPU time, GPU time (GL timer queries), ImGui vertex and index counts, heap
+ * allocations made on the renderer thread (see alloc_counter.h) and animations in motion.
+ *
+ * The overlay is toggled with F3, or shown from launch with MILLENNIUM_PERF_HUD=1. --perf-csv=<file> writes one row
+ * per frame for automated runs; add --perf-frames=<n> to draw continuously and close after n frames, e.g. under
+ * xvfb-run with LIBGL_ALWAYS_SOFTWARE=1 on CI. Nothing is measured while both are off.
+ *
+ * Renderer thread only, apart from Initialize().
+ */
+namespace PerfHud
+{
+/** Parse --perf-csv=<file> and --perf-frames=<n>, and read MILLENNIUM_PERF_HUD. */
+void Initialize(int argc, char** argv);
+
+/** Start of RenderImGui(), before NewFrame(). */
+void BeginFrame();
+
+/** Between the last window and Render(): handles the toggle key and draws the overlay. */
+void Render();
+
+/** Around the GL backend's draw call, so the timer query covers exactly the UI's GPU work. */
+void BeginGpuWork();
+void EndFrame(const ImDrawData* drawData);
+
+/** Whether --perf-frames has been reached and the window should close. */
+bool IsFinished();
+
+/** Resolve outstanding queries, flush the CSV and release GL objects, with the context still current. */
+void Shutdown();
+} // namespace PerfHud
@@ -0,0 +1,82 @@
+/**
+ * ==================================================
+ *   _____ _ _ _             _
+ *  |     |_| | |___ ___ ___|_|_ _ _____
+ *  | | | | | | | -_|   |   | | | |     |
+ *  |_|_|_|_|_|_|___|_|_|_|_|_|___|_|_|_|
+ *
+ * ==================================================
+ *
+ * Copyright (c) 2025 Project Millennium
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+#include <functional>
+#include <string>
+#include <vector>
+#include <http.h>
+
+/**
+ * Where release metadata and assets are fetched from.
+ *
+ * GitHub is the only source by default. Mirrors are configured with --release-source=<url> (repeatable) or
+ * MILLENNIUM_RELEASE_SOURCES=<url>[;<url>...]; the first entry is the primary and the rest are fallbacks, and the
+ * keyword "github" places GitHub itself in the list. A mirror serves the GitHub REST layout under its base URL
+ * (<url>/repos/<owner>/<repo>/releases) and assets under <url>/<owner>/<repo>/releases/download/<tag>/<name>.
+ *
+ * When more than one source is configured, the first request races all of them and keeps the one that answers first.
+ * Archive digests are still verified, but they come from the release metadata, so only configure mirrors you trust.
+ * tools/local_mirror.py is a minimal stand-in mirror for offline testing and benchmarking.
+ */
+namespace ReleaseSource
+{
+struct Source
+{
+    std::string apiBase;      // e.g. https://api.github.com
+    std::string downloadBase; // e.g. https://github.com
+};
+
+/** Read the configured sources from the command line and environment. */
+void Initialize(int argc, char** argv);
+
+/** Configured sources, fastest (or primary, before the race) first. */
+std::vector<Source> GetSources();
+
+/** Race a small request against every source and move the one that returned its first byte soonest to the front. */
+void SelectFastest();
+
+/**
+ * GET <apiBase><pathAndQuery>, e.g. "/repos/SteamClientHomebrew/Millennium/releases?per_page=100&page=1".
+ * Falls through to the next source on network errors, rate limits and 5xx responses.
+ * @return The response from the first source that answered, or the last failure.
+ */
+Http::Response Get(const std::string& pathAndQuery);
+
+/** Map a GitHub asset URL onto every source, in preference order. URLs that don't point at GitHub are returned unchanged. */
+std::vector<std::string> GetDownloadUrls(const std::string& browserDownloadUrl);
+
+/** Http::Get() an asset, trying each source in turn. Returns an empty string if none of them served it. */
+std::string GetAsset(const std::string& browserDownloadUrl);
+
+/** Http::downloadFile() an asset, trying each source in turn. Only the final failure is reported to the user, and only if showErrors is set. */
+bool DownloadFile(const std::string& browserDownloadUrl, const std::string& outputPath, double fileSize = 0, std::function<void(double, double)> progressCallback = nullptr,
+                  bool showProgress = true, bool showErrors = true);
+} // namespace ReleaseSource
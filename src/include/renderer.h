@@ -40,8 +40,11 @@ extern int WINDOW_HEIGHT;
 void GLFWErrorCallback(int error, const char* description);
 void WindowRefreshCallback(GLFWwindow* window);
 void FrameBufferSizeCallback(GLFWwindow* window, int width, int height);
+void WindowPosCallback(GLFWwindow* window, int x, int y);
 void SetupImGuiScaling(GLFWwindow* window);
 void RequestFontRebuild();
 bool IsWindowFocused();
 void SpawnRendererThread(GLFWwindow* window, const char* glsl_version, std::shared_ptr<RouterNav> router);
+/** One UI frame from NewFrame() to Render(), without touching the window or GL; RenderImGui() submits and presents it. */
+void BuildFrame(std::shared_ptr<RouterNav> router);
 void RenderImGui(GLFWwindow* window, std::shared_ptr<RouterNav> router);
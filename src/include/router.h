@@ -33,6 +33,7 @@
 #include <vector>
 #include <memory>
 #include <iostream>
+#include <draw_snapshot.h>
 
 class RouterNav;
 using Component = std::function<void(std::shared_ptr<RouterNav> router, float xOffset)>;
@@ -43,7 +44,7 @@ enum AnimationDirection
     BACKWARD = -1
 };
 
-class RouterNav
+class RouterNav : public std::enable_shared_from_this<RouterNav>
 {
   public:
     RouterNav(const std::vector<Component>& components) : softCanGoBack(false), softCanGoForward(false), components(components), currentIndex(0), isAnimating(false), animTime(0.0f)
@@ -70,6 +71,13 @@ class RouterNav
 
     void update();
 
+    /**
+     * Draw the routes into the current window: the current one and, during a slide, the one sliding in. A route that is
+     * entirely off-screen is skipped. The route sliding out takes no part in the next page, so it is built once on the
+     * first frame of the slide and its geometry is moved along after that instead of being rebuilt.
+     */
+    void render(float viewportWidth);
+
     float getCurrentOffset(float viewportWidth) const;
     float getTransitioningOffset(float viewportWidth) const;
 
@@ -92,6 +100,19 @@ class RouterNav
     bool softCanGoBack = false;
     bool softCanGoForward = false;
 
+    enum class SnapshotState
+    {
+        Pending,
+        Ready,
+        Unavailable
+    };
+
+    DrawSnapshot outgoingSnapshot;
+    SnapshotState outgoingState = SnapshotState::Pending;
+    float outgoingSnapshotOffset = 0.0f;
+
     float lerp(float a, float b, float t) const;
     void startAnimation(int direction);
+    void renderOutgoing(float xOffset);
+    void renderComponent(size_t index, float xOffset);
 };
@@ -0,0 +1,76 @@
+/**
+ * ==================================================
+ *   _____ _ _ _             _
+ *  |     |_| | |___ ___ ___|_|_ _ _____
+ *  | | | | | | | -_|   |   | | | |     |
+ *  |_|_|_|_|_|_|___|_|_|_|_|_|___|_|_|_|
+ *
+ * ==================================================
+ *
+ * Copyright (c) 2025 Project Millennium
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <thread>
+#include <vector>
+
+/** Whether `entry` is a symlink or, on Windows, a junction. Tree walks don't follow either. */
+bool IsLinkEntry(const std::filesystem::directory_entry& entry, std::error_code& ec);
+
+/**
+ * Sizes groups of files and directory trees in the background (one group per uninstall component).
+ *
+ * Every root path becomes a task on a TaskPool, and every subdirectory found becomes another, so large trees are spread
+ * over all workers. While the scan runs, each group's running total is handed to `onProgress` a few times a second, and
+ * once more with `finished` set at the end. Symlinks and junctions are not followed, and unreadable entries are skipped.
+ *
+ * `onProgress` runs on the scan's own thread; post to UiEvents from it to reach the UI.
+ */
+class SizeScan
+{
+  public:
+    using Progress = std::function<void(const std::vector<uint64_t>& totals, bool finished)>;
+
+    SizeScan(std::vector<std::vector<std::filesystem::path>> groups, Progress onProgress);
+    /** Cancels the scan. */
+    ~SizeScan();
+
+    SizeScan(const SizeScan&) = delete;
+    SizeScan& operator=(const SizeScan&) = delete;
+
+    /** Stop walking and wait for the workers to notice. `onProgress` is not called again once this returns. */
+    void cancel();
+
+  private:
+    void run(std::vector<std::vector<std::filesystem::path>> groups);
+    std::vector<uint64_t> snapshot() const;
+
+    Progress m_onProgress;
+    std::unique_ptr<std::atomic<uint64_t>[]> m_totals;
+    size_t m_groupCount;
+    std::atomic<bool> m_cancelled{ false };
+    std::thread m_thread;
+};
@@ -0,0 +1,72 @@
+/**
+ * ==================================================
+ *   _____ _ _ _             _
+ *  |     |_| | |___ ___ ___|_|_ _ _____
+ *  | | | | | | | -_|   |   | | | |     |
+ *  |_|_|_|_|_|_|___|_|_|_|_|_|___|_|_|_|
+ *
+ * ==================================================
+ *
+ * Copyright (c) 2025 Project Millennium
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+#include <trace.h>
+#include <string>
+
+/**
+ * Startup instrumentation, from process entry to the first glfwShowWindow.
+ *
+ * Each phase of startup is wrapped in a STARTUP_PHASE scope, which records its start and duration relative to
+ * process entry (and mirrors it into the trace, when tracing is on). Once the first frame is shown the breakdown is
+ * printed, nested phases indented under the phase that ran them. With --startup-benchmark=<file> the same breakdown
+ * is written as JSON and the installer exits after its first frame, which is what tools/check_startup.py measures in CI.
+ */
+namespace StartupProfile
+{
+/** Parse --startup-benchmark=<file> from the command line. */
+void Initialize(int argc, char** argv);
+
+/** Whether the installer should close once the first frame is shown. */
+bool IsBenchmark();
+
+/** Record the first frame, print the breakdown and write the benchmark report. Later calls do nothing. */
+void FirstFrameShown();
+
+/** RAII startup phase. The name must be a string literal. Phases that end after the first frame are not recorded. */
+class Phase
+{
+  public:
+    explicit Phase(const char* name);
+    ~Phase();
+
+    Phase(const Phase&) = delete;
+    Phase& operator=(const Phase&) = delete;
+
+  private:
+    const char* m_name;
+    double m_start;
+    int m_depth;
+    Trace::Scope m_trace;
+};
+} // namespace StartupProfile
+
+#define STARTUP_PHASE(name) StartupProfile::Phase TRACE_CONCAT(_startupPhase, __LINE__)(name)
@@ -0,0 +1,102 @@
+/**
+ * ==================================================
+ *   _____ _ _ _             _
+ *  |     |_| | |___ ___ ___|_|_ _ _____
+ *  | | | | | | | -_|   |   | | | |     |
+ *  |_|_|_|_|_|_|___|_|_|_|_|_|___|_|_|_|
+ *
+ * ==================================================
+ *
+ * Copyright (c) 2025 Project Millennium
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * Fork-join thread pool for fanning filesystem work out over a tree, such as sizing or deleting a directory.
+ *
+ * Every worker owns a queue. A task submitted from inside a task goes onto its own worker's queue and is picked back up
+ * newest-first, so a walk stays depth-first and cache-warm. A worker with nothing left steals the oldest task from
+ * another queue, which is usually the biggest remaining subtree. Tasks report failures through their own state rather
+ * than by throwing.
+ */
+class TaskPool
+{
+  public:
+    using Task = std::function<void()>;
+
+    /** `threadCount` of 0 picks one per hardware thread, capped at 8 since the work is I/O bound. */
+    explicit TaskPool(size_t threadCount = 0);
+    /** Waits for outstanding tasks, then stops the workers. */
+    ~TaskPool();
+
+    TaskPool(const TaskPool&) = delete;
+    TaskPool& operator=(const TaskPool&) = delete;
+
+    /** Queue `task`. Safe to call from any thread, including from inside a running task. */
+    void submit(Task task);
+
+    /** Block until every submitted task, and everything those tasks submitted, has run. */
+    void wait();
+
+    /** Like wait(), but gives up after `timeout`. Returns true once everything has run. */
+    bool waitFor(std::chrono::milliseconds timeout);
+
+    size_t threadCount() const
+    {
+        return m_threads.size();
+    }
+
+  private:
+    struct Queue
+    {
+        std::mutex mutex;
+        std::deque<Task> tasks;
+    };
+
+    void workerLoop(size_t index);
+    bool popLocal(size_t index, Task& task);
+    bool steal(size_t index, Task& task);
+
+    std::vector<std::unique_ptr<Queue>> m_queues;
+    std::vector<std::thread> m_threads;
+
+    /** Tasks sitting in a queue, and tasks submitted but not yet finished */
+    std::atomic<size_t> m_queued{ 0 };
+    std::atomic<size_t> m_pending{ 0 };
+    std::atomic<size_t> m_nextQueue{ 0 };
+
+    std::mutex m_wakeMutex;
+    std::condition_variable m_wake;
+    bool m_stopping = false;
+
+    std::mutex m_doneMutex;
+    std::condition_variable m_done;
+};
@@ -68,3 +68,6 @@ class TaskScheduler
     size_t currentTaskIndex;
     std::unique_ptr<double> currentTaskProgress;
 };
+
+/** Scheduler driving the current install, defined in routes/installer.cc. */
+extern std::unique_ptr<TaskScheduler> scheduler;
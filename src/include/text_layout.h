@@ -0,0 +1,54 @@
+/**
+ * ==================================================
+ *   _____ _ _ _             _
+ *  |     |_| | |___ ___ ___|_|_ _ _____
+ *  | | | | | | | -_|   |   | | | |     |
+ *  |_|_|_|_|_|_|___|_|_|_|_|_|___|_|_|_|
+ *
+ * ==================================================
+ *
+ * Copyright (c) 2025 Project Millennium
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+#include <imgui.h>
+
+/**
+ * Layout cache for text that doesn't change between frames, so centering a label or wrapping a paragraph measures it
+ * once instead of every frame.
+ *
+ * Entries are keyed by the string's address together with the current font, its size (which already carries the DPI
+ * scale) and the wrap width. Only pass strings whose contents never change at that address: locale strings and
+ * literals. Everything is dropped when a font atlas is installed or the language changes.
+ *
+ * @note Renderer thread only.
+ */
+namespace TextLayout
+{
+/** Same as ImGui::CalcTextSize(text) in the current font. */
+ImVec2 Measure(const char* text);
+
+/** Same as ImGui::TextWrapped("%s", text), with the line breaks computed once per wrap width. */
+void TextWrapped(const char* text);
+
+/** Forget every cached layout. */
+void Invalidate();
+} // namespace TextLayout
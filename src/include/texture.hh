@@ -34,16 +34,30 @@
 #endif
 #include <GL/gl.h>
 
-extern GLuint logoTexture;
-extern GLuint infoIconTexture;
-extern GLuint closeButtonTexture;
-extern GLuint discordIconTexture;
-extern GLuint gtihubIconTexture;
-extern GLuint backBtnTexture;
-extern GLuint excludedIconTexture;
-extern GLuint errorIconTexture;
-extern GLuint successIconTexture;
-extern GLuint languageIconTexture;
+#include <imgui.h>
 
-bool LoadTextureFromMemory(const void* data, size_t data_size, GLuint* out_texture, int* out_width = nullptr, int* out_height = nullptr);
-void LoadTextures();
\ No newline at end of file
+/** Embedded icons, packed at build time into a single texture. Order matches the --icon arguments in CMakeLists.txt. */
+enum class Icon
+{
+    Logo,
+    CloseButton,
+    Info,
+    Discord,
+    Github,
+    BackButton,
+    Excluded,
+    Error,
+    Success,
+    Language,
+    Count
+};
+
+extern GLuint iconAtlasTexture;
+
+void LoadTextures();
+
+/**
+ * Draw an embedded icon. Every icon samples the same texture, so consecutive icons in a
+ * window batch into the same draw command.
+ */
+void DrawIcon(Icon icon, const ImVec2& size);
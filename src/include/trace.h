@@ -0,0 +1,96 @@
+/**
+ * ==================================================
+ *   _____ _ _ _             _
+ *  |     |_| | |___ ___ ___|_|_ _ _____
+ *  | | | | | | | -_|   |   | | | |     |
+ *  |_|_|_|_|_|_|___|_|_|_|_|_|___|_|_|_|
+ *
+ * ==================================================
+ *
+ * Copyright (c) 2025 Project Millennium
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+#include <cstdint>
+#include <string>
+
+/**
+ * Lightweight install-pipeline tracing.
+ *
+ * Spans and counters are recorded into a fixed-size ring buffer owned by the calling thread, so recording never
+ * takes a lock. When tracing is enabled (--trace[=file] on the command line, or MILLENNIUM_TRACE=<file> in the
+ * environment) the buffers are dumped as a Chrome trace_event JSON file that can be opened in Perfetto or chrome://tracing.
+ */
+namespace Trace
+{
+/** Enable tracing if MILLENNIUM_TRACE is set. An explicit outputPath (from --trace) takes precedence. */
+void Initialize(const std::string& outputPath = {});
+
+bool IsEnabled();
+
+/** Label the calling thread in the exported trace (e.g. "renderer", "worker"). */
+void SetThreadName(const char* name);
+
+/** Record a counter sample, shown as a track in Perfetto. */
+void Counter(const char* name, double value);
+
+/** Record a zero-length marker. */
+void Instant(const char* name, const char* category = "installer");
+
+/** Write every recorded event to the output file. Safe to call more than once; each call rewrites the whole file. */
+bool Flush();
+
+/**
+ * RAII span. The name and category must be string literals (or otherwise outlive the trace);
+ * per-instance details such as a file name go into `detail`, which is copied and truncated.
+ */
+class Scope
+{
+  public:
+    Scope(const char* name, const char* category = "installer", const std::string& detail = {});
+    ~Scope();
+
+    Scope(const Scope&) = delete;
+    Scope& operator=(const Scope&) = delete;
+
+  private:
+    const char* m_name;
+    const char* m_category;
+    std::string m_detail;
+    uint64_t m_start;
+    bool m_active;
+};
+} // namespace Trace
+
+#define TRACE_CONCAT_INNER(a, b) a##b
+#define TRACE_CONCAT(a, b) TRACE_CONCAT_INNER(a, b)
+#define TRACE_EXPAND(x) x
+
+/**
+ * TRACE_SCOPE(name[, category[, detail]]). The detail expression is only evaluated while tracing is enabled, so call
+ * sites can build it with std::to_string or path.string() without paying for it in normal runs.
+ */
+#define TRACE_SCOPE_1(name) Trace::Scope TRACE_CONCAT(_traceScope, __LINE__)(name)
+#define TRACE_SCOPE_2(name, category) Trace::Scope TRACE_CONCAT(_traceScope, __LINE__)(name, category)
+#define TRACE_SCOPE_3(name, category, detail) \
+    Trace::Scope TRACE_CONCAT(_traceScope, __LINE__)(name, category, Trace::IsEnabled() ? std::string(detail) : std::string())
+#define TRACE_SCOPE_SELECT(_1, _2, _3, macro, ...) macro
+#define TRACE_SCOPE(...) TRACE_EXPAND(TRACE_SCOPE_SELECT(__VA_ARGS__, TRACE_SCOPE_3, TRACE_SCOPE_2, TRACE_SCOPE_1)(__VA_ARGS__))
@@ -0,0 +1,116 @@
+/**
+ * ==================================================
+ *   _____ _ _ _             _
+ *  |     |_| | |___ ___ ___|_|_ _ _____
+ *  | | | | | | | -_|   |   | | | |     |
+ *  |_|_|_|_|_|_|___|_|_|_|_|_|___|_|_|_|
+ *
+ * ==================================================
+ *
+ * Copyright (c) 2025 Project Millennium
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+#include <task_pool.h>
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/**
+ * Deletes groups of files and directory trees (one group per uninstall component) across a TaskPool.
+ *
+ * The constructor walks every tree once, so each group's file count and size are known before anything is removed.
+ * run() then deletes the files in parallel batches, and removes the directories deepest first once they are empty. A
+ * path that can't be removed is recorded against its group, and everything else carries on. Symlinks and junctions are
+ * removed themselves, never followed.
+ *
+ * @note Blocks the calling thread; run it from a worker.
+ */
+class TreeRemover
+{
+  public:
+    struct Counts
+    {
+        uint64_t bytes = 0;
+        uint64_t files = 0;
+
+        bool operator==(const Counts& other) const = default;
+    };
+
+    struct Failure
+    {
+        std::filesystem::path path;
+        std::string message;
+    };
+
+    struct GroupResult
+    {
+        Counts removed;
+        std::vector<Failure> failures;
+    };
+
+    /** Called with each group's removed counts, a few times a second while run() deletes, and once at the end */
+    using Progress = std::function<void(const std::vector<Counts>& removed)>;
+
+    explicit TreeRemover(const std::vector<std::vector<std::filesystem::path>>& groups);
+
+    /** Per-group totals found by the walk. */
+    const std::vector<Counts>& totals() const
+    {
+        return m_totals;
+    }
+
+    /** Delete everything that was found. Returns one result per group. */
+    std::vector<GroupResult> run(const Progress& onProgress);
+
+  private:
+    struct File
+    {
+        std::filesystem::path path;
+        uint64_t size;
+    };
+
+    struct Group
+    {
+        std::mutex mutex;
+        std::vector<File> files;
+        std::vector<std::filesystem::path> directories;
+        std::vector<Failure> failures;
+
+        std::atomic<uint64_t> removedBytes{ 0 };
+        std::atomic<uint64_t> removedFiles{ 0 };
+    };
+
+    void enumerate(Group& group, const std::filesystem::path& directory);
+    void removeFiles(Group& group, size_t first, size_t last);
+    void removeDirectories(Group& group);
+    std::vector<Counts> snapshot() const;
+
+    std::vector<std::unique_ptr<Group>> m_groups;
+    std::vector<Counts> m_totals;
+    /** Last, so it is torn down before the groups its tasks point into */
+    TaskPool m_pool;
+};
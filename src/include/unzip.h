@@ -28,7 +28,9 @@
  * SOFTWARE.
  */
 
+ #include <atomic>
  #include <filesystem>
+ #include <mapped_file.h>
  #include <zlib.h>
  #include <mz_compat.h>
  
@@ -40,4 +42,10 @@
 
  bool IsDirectoryPath(const std::filesystem::path& path);
 
- bool ExtractZippedArchive(const char *zipFilePath, const char *outputDirectory, double* overallProgress, double* fileProgress);
\ No newline at end of file
+ bool ExtractZippedArchive(const char *zipFilePath, const char *outputDirectory, std::atomic<double>* overallProgress, std::atomic<double>* fileProgress);
+
+ /**
+  * Extract an already mapped archive. Safe to call concurrently on the same MappedFile;
+  * each call reads through its own stream and writes to its own output directory.
+  */
+ bool ExtractZippedArchive(const MappedFile& archive, const char *outputDirectory, std::atomic<double>* overallProgress, std::atomic<double>* fileProgress);
\ No newline at end of file
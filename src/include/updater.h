@@ -29,4 +29,45 @@
  */
 
 #pragma once
-void CheckForAndDownloadUpdates();
\ No newline at end of file
+#include <string>
+
+/**
+ * Self-update of the Windows installer.
+ *
+ * The check runs on its own thread while the window and fonts initialize, so time to first frame never waits on the
+ * network. A newer release is downloaded to a staging file in the background and announced through GetStatus(); the
+ * UI then asks the user, and only RestartIntoUpdate() swaps the running executable for it and relaunches.
+ */
+namespace Updater
+{
+enum class Status
+{
+    Idle,
+    Checking,
+    UpToDate,
+    Downloading,
+    ReadyToRestart,
+    Failed
+};
+
+/** Start checking for, and downloading, a newer installer in the background. Does nothing off Windows. */
+void BeginCheck();
+
+/** Safe to call from any thread. The renderer is woken whenever it changes. */
+Status GetStatus();
+
+/** Tag of the staged release, e.g. "v1.12.0". Only meaningful once GetStatus() returns ReadyToRestart. */
+std::string GetAvailableVersion();
+
+/** Whether the background check is still running. Exiting must not wait on it, since a download has no deadline. */
+bool IsRunning();
+
+/** Replace the running executable with the staged one and launch it. Only returns if that failed. */
+void RestartIntoUpdate();
+
+/** Keep the current version for this session. The staged download is replaced by the next check. */
+void Dismiss();
+
+/** Whether the user already chose to keep the current version. */
+bool IsDismissed();
+} // namespace Updater
@@ -348,109 +348,9 @@ static bool KillSteamProcess()
     return false;
 }
 
-static uint64_t GetFolderSize(const std::filesystem::path& path, std::error_code& ec)
-{
-    ec.clear();
-    std::wstring root = path.wstring();
-
-    DWORD attrs = GetFileAttributesW(root.c_str());
-    if (attrs == INVALID_FILE_ATTRIBUTES) {
-        ec = std::error_code(static_cast<int>(GetLastError()), std::system_category());
-        return 0;
-    }
-
-    if (!(attrs & FILE_ATTRIBUTE_DIRECTORY)) {
-        DWORD high = 0;
-        DWORD low = GetCompressedFileSizeW(root.c_str(), &high);
-        if (low == INVALID_FILE_SIZE && GetLastError() != NO_ERROR) {
-            ec = std::error_code(static_cast<int>(GetLastError()), std::system_category());
-            return 0;
-        }
-        return (static_cast<uint64_t>(high) << 32) | low;
-    }
-
-    uint64_t total = 0;
-    std::vector<std::wstring> stack;
-    stack.push_back(root);
-
-    while (!stack.empty()) {
-        std::wstring current = std::move(stack.back());
-        stack.pop_back();
-
-        std::wstring search = current;
-        if (!search.empty() && search.back() != L'\\' && search.back() != L'/') {
-            search.push_back(L'\\');
-        }
-        search += L"*";
-
-        WIN32_FIND_DATAW fd;
-        HANDLE hFind = FindFirstFileExW(search.c_str(), FindExInfoBasic, &fd, FindExSearchNameMatch, NULL, FIND_FIRST_EX_LARGE_FETCH);
-        if (hFind == INVALID_HANDLE_VALUE) {
-            DWORD err = GetLastError();
-            if (err == ERROR_ACCESS_DENIED || err == ERROR_SHARING_VIOLATION || err == ERROR_PATH_NOT_FOUND) {
-                continue;
-            }
-            ec = std::error_code(static_cast<int>(err), std::system_category());
-            continue;
-        }
-
-        do {
-            const wchar_t* name = fd.cFileName;
-            if (wcscmp(name, L".") == 0 || wcscmp(name, L"..") == 0) {
-                continue;
-            }
-
-            if (fd.dwFileAttributes & FILE_ATTRIBUTE_REPARSE_POINT) {
-                continue;
-            }
-
-            std::wstring fullPath = current;
-            if (!fullPath.empty() && fullPath.back() != L'\\' && fullPath.back() != L'/') {
-                fullPath.push_back(L'\\');
-            }
-            fullPath += name;
-
-            if (fd.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) {
-                stack.push_back(fullPath);
-            } else {
-                DWORD high = 0;
-                DWORD low = GetCompressedFileSizeW(fullPath.c_str(), &high);
-                if (low == INVALID_FILE_SIZE && GetLastError() != NO_ERROR) {
-                    continue;
-                }
-                total += (static_cast<uint64_t>(high) << 32) | low;
-            }
-        } while (FindNextFileW(hFind, &fd));
-
-        FindClose(hFind);
-    }
-
-    return total;
-}
-
 #else // !_WIN32
 
 static void StartSteamFromPath(std::string) {}
 static bool KillSteamProcess() { return false; }
 
-static uint64_t GetFolderSize(const std::filesystem::path& path, std::error_code& ec)
-{
-    ec.clear();
-    uint64_t total = 0;
-
-    if (!std::filesystem::exists(path, ec) || ec)
-        return 0;
-
-    if (std::filesystem::is_regular_file(path, ec))
-        return std::filesystem::file_size(path, ec);
-
-    for (const auto& entry : std::filesystem::recursive_directory_iterator(path, std::filesystem::directory_options::skip_permission_denied, ec)) {
-        if (entry.is_regular_file(ec))
-            total += entry.file_size(ec);
-        ec.clear();
-    }
-
-    return total;
-}
-
 #endif // _WIN32
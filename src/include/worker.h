@@ -33,6 +33,7 @@
 #include <functional>
 #include <atomic>
 #include <mutex>
+#include <frame_scheduler.h>
 
 class BackgroundWorker
 {
@@ -49,12 +50,15 @@ class BackgroundWorker
     void run(std::function<void()> fn)
     {
         join();
+        /** Set before the thread exists, or a task that finishes first would leave the worker busy for good */
+        m_busy.store(true, std::memory_order_release);
         m_thread = std::thread([this, fn = std::move(fn)]()
         {
             fn();
             m_busy.store(false, std::memory_order_release);
+            /** Whatever the task produced needs to be drawn */
+            FrameScheduler::RequestFrame();
         });
-        m_busy.store(true, std::memory_order_release);
     }
 
     bool busy() const
@@ -0,0 +1,293 @@
+/**
+ * ==================================================
+ *   _____ _ _ _             _
+ *  |     |_| | |___ ___ ___|_|_ _ _____
+ *  | | | | | | | -_|   |   | | | |     |
+ *  |_|_|_|_|_|_|___|_|_|_|_|_|___|_|_|_|
+ *
+ * ==================================================
+ *
+ * Copyright (c) 2025 Project Millennium
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <headless.h>
+#include <components.h>
+#include <task_scheduler.h>
+#include <trace.h>
+#include <util.h>
+#include <nlohmann/json.hpp>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <format>
+#include <iostream>
+#include <mutex>
+#include <string_view>
+#include <thread>
+#include <vector>
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+namespace
+{
+std::mutex g_outputMutex;
+
+/** Write one JSON event per line to stdout. Diagnostic logging is moved to stderr so stdout stays machine-readable. */
+void EmitEvent(const nlohmann::json& event)
+{
+    const std::string line = event.dump(-1, ' ', false, nlohmann::json::error_handler_t::replace);
+
+    std::lock_guard<std::mutex> lock(g_outputMutex);
+    std::fputs(line.c_str(), stdout);
+    std::fputc('\n', stdout);
+    std::fflush(stdout);
+}
+
+void EmitError(const std::string& message)
+{
+    EmitEvent({
+        { "event",   "error" },
+        { "message", message },
+    });
+}
+
+[[noreturn]] void ExitWithUsageError(const std::string& message)
+{
+    EmitError(message + " (usage: --headless [--steam-path <dir>]... [--tag <release>] [--start-steam] [--release-source=<url>]... [--trace[=file]])");
+    std::exit(2);
+}
+
+#ifdef _WIN32
+/** The installer is a GUI-subsystem executable, so attach to the launching console when stdout isn't redirected. */
+void AttachParentConsoleIfNeeded()
+{
+    HANDLE stdoutHandle = GetStdHandle(STD_OUTPUT_HANDLE);
+    if (stdoutHandle != NULL && stdoutHandle != INVALID_HANDLE_VALUE) {
+        return;
+    }
+
+    if (!AttachConsole(ATTACH_PARENT_PROCESS)) {
+        return;
+    }
+
+    FILE* file;
+    freopen_s(&file, "CONOUT$", "w", stdout);
+    freopen_s(&file, "CONOUT$", "w", stderr);
+}
+#endif
+} // namespace
+
+std::optional<HeadlessOptions> ParseHeadlessOptions(int argc, char** argv)
+{
+    const bool isHeadless = std::any_of(argv + 1, argv + argc, [](const char* arg) { return std::string_view(arg) == "--headless"; });
+    if (!isHeadless) {
+        return std::nullopt;
+    }
+
+    HeadlessOptions options;
+
+    for (int i = 1; i < argc; i++) {
+        const std::string arg = argv[i];
+
+        /** Accept both "--option value" and "--option=value" */
+        const auto readValue = [&](const std::string& name, std::string& out) -> bool
+        {
+            if (arg == name) {
+                if (i + 1 >= argc) {
+                    ExitWithUsageError(std::format("Missing value for {}", name));
+                }
+                out = argv[++i];
+                return true;
+            }
+            if (arg.rfind(name + "=", 0) == 0) {
+                out = arg.substr(name.size() + 1);
+                return true;
+            }
+            return false;
+        };
+
+        if (arg == "--headless") {
+            continue;
+        }
+        if (arg == "--start-steam") {
+            options.startSteam = true;
+            continue;
+        }
+        if (arg == "--trace" || arg.rfind("--trace=", 0) == 0) {
+            continue; // handled by Trace::Initialize
+        }
+        if (arg.rfind("--release-source=", 0) == 0) {
+            continue; // handled by ReleaseSource::Initialize
+        }
+        if (std::string steamPath; readValue("--steam-path", steamPath)) {
+            options.steamPaths.push_back(steamPath);
+            continue;
+        }
+        if (readValue("--tag", options.releaseTag)) {
+            continue;
+        }
+
+        ExitWithUsageError(std::format("Unknown argument '{}'", arg));
+    }
+
+    return options;
+}
+
+int RunHeadlessInstall(const HeadlessOptions& options)
+{
+#ifdef _WIN32
+    AttachParentConsoleIfNeeded();
+#endif
+    std::cout.rdbuf(std::cerr.rdbuf());
+
+    TRACE_SCOPE("RunHeadlessInstall", "headless");
+
+    /** Anything that would have popped up a dialog is reported as an event instead */
+    SetMessageBoxHandler([](const std::string& title, const std::string& body, MessageLevel level)
+    {
+        EmitEvent({
+            { "event",   level == Error ? "error" : level == Warning ? "warning" : "info" },
+            { "title",   title                                                           },
+            { "message", body                                                            },
+        });
+    });
+
+    std::vector<std::string> steamPaths = options.steamPaths;
+    if (steamPaths.empty()) {
+        steamPaths.push_back(GetSteamPath());
+    }
+
+    for (const auto& steamPath : steamPaths) {
+        if (steamPath.empty()) {
+            EmitError("Could not locate a Steam installation, pass --steam-path <dir>.");
+            return 1;
+        }
+
+        std::error_code ec;
+        if (!std::filesystem::is_directory(steamPath, ec)) {
+            EmitError(std::format("Steam path '{}' is not a directory.", steamPath));
+            return 1;
+        }
+    }
+
+    EmitEvent({
+        { "event", "fetch" },
+    });
+
+    /** FetchVersionInfo reports its own failures through the message box handler */
+    if (!FetchVersionInfo()) {
+        return 1;
+    }
+
+    if (!options.releaseTag.empty() && !SelectReleaseByTag(options.releaseTag)) {
+        EmitError(std::format("Release '{}' was not found or has no asset for this platform.", options.releaseTag));
+        return 1;
+    }
+
+    const std::string releaseTag = selectedRelease.value("tag_name", std::string());
+
+    EmitEvent({
+        { "event",     "start"                                      },
+        { "tag",       releaseTag                                   },
+        { "asset",     osReleaseInfo.value("name", std::string())   },
+        { "size",      osReleaseInfo.value("size", 0.0)             },
+        { "steamPaths", steamPaths                                  },
+    });
+
+    std::atomic<bool> isFinished{ false };
+
+    std::thread progressReporter([&isFinished]()
+    {
+        double lastProgress = -1.0;
+        size_t lastTaskIndex = SIZE_MAX;
+
+        while (!isFinished.load(std::memory_order_acquire)) {
+            const double progress = scheduler->getProgress();
+            const size_t taskIndex = scheduler->getCurrentTaskIndex();
+
+            /** Only report meaningful changes so the stream stays small on fast disks */
+            if (taskIndex != lastTaskIndex || progress - lastProgress >= 0.01) {
+                nlohmann::json targets = nlohmann::json::array();
+                for (const auto& target : GetInstallTargets()) {
+                    targets.push_back({
+                        { "steamPath", target.steamPath },
+                        { "progress",  target.progress  },
+                    });
+                }
+
+                EmitEvent({
+                    { "event",     "progress"                 },
+                    { "task",      taskIndex + 1              },
+                    { "taskCount", scheduler->getTaskCount()  },
+                    { "progress",  progress                   },
+                    { "targets",   targets                    },
+                });
+                lastProgress = progress;
+                lastTaskIndex = taskIndex;
+            }
+
+            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        }
+    });
+
+    StartInstaller(steamPaths, selectedRelease, osReleaseInfo);
+
+    isFinished.store(true, std::memory_order_release);
+    progressReporter.join();
+
+    /** Targets never reach 'finished' if the download or signature check failed */
+    for (const auto& target : GetInstallTargets()) {
+        if (!target.finished) {
+            continue;
+        }
+        EmitEvent({
+            { "event",     "target"         },
+            { "steamPath", target.steamPath },
+            { "success",   target.success   },
+            { "message",   target.message   },
+        });
+    }
+
+    if (scheduler->hasFailed()) {
+        EmitEvent({
+            { "event",   "failed"                       },
+            { "message", scheduler->getFailureReason() },
+        });
+        return 1;
+    }
+
+    EmitEvent({
+        { "event",      "complete" },
+        { "tag",        releaseTag },
+        { "steamPaths", steamPaths },
+    });
+
+    /** Only one Steam can run at a time, start the first root */
+    if (options.startSteam) {
+        StartSteamFromPath(steamPaths.front());
+    }
+    return 0;
+}
@@ -29,6 +29,7 @@
  */
 
 #include "task_scheduler.h"
+#include <trace.h>
 #include <algorithm>
 #include <iostream>
 
@@ -86,7 +87,10 @@ void TaskScheduler::run()
         return;
     }
 
+    TRACE_SCOPE("TaskScheduler::run", "scheduler");
+
     for (size_t i = 0; i < tasks.size(); i++) {
+        TRACE_SCOPE("task", "scheduler", std::to_string(i + 1) + "/" + std::to_string(tasks.size()));
         {
             std::lock_guard<std::mutex> lock(m_mutex);
             currentTaskIndex = i;
@@ -115,6 +119,7 @@ void TaskScheduler::run()
 
         *currentTaskProgress = std::min(1.0, *currentTaskProgress);
         overallProgress = getProgress_locked();
+        Trace::Counter("overallProgress", overallProgress);
     }
 
     std::lock_guard<std::mutex> lock(m_mutex);
@@ -31,13 +31,17 @@
 #include <sys/stat.h>
 #include <sys/types.h>
 #include <zlib.h>
+#include <mz.h>
+#include <mz_strm.h>
+#include <mz_strm_mem.h>
 #include <mz_compat.h>
+#include <unzip.h>
+#include <trace.h>
 #include <iostream>
 #include <filesystem>
+#include <limits>
 #include <vector>
 
-#define WRITE_BUFFER_SIZE 8192
-
 /**
  * @brief Create directories that do not exist.
  * @note This function is used to create directories that do not exist when extracting a zip archive.
@@ -46,6 +50,7 @@
  */
 bool CreateNonExistentDirectories(std::filesystem::path path)
 {
+    TRACE_SCOPE("CreateDirectories", "filesystem", path.string());
     std::filesystem::path dir_path(path);
     try {
         std::filesystem::create_directories(dir_path);
@@ -98,22 +103,12 @@ bool IsDirectoryPath(const std::filesystem::path& path)
 }
 
 /**
- * @brief Extract a zipped archive to a directory.
- * @param zipFilePath The path to the zip file.
- * @param outputDirectory The directory to extract the zip file to.
- * @param overallProgress Pointer to a double to track overall progress (0-1 scale).
- * @param fileProgress Pointer to a double to track file progress (0-1 scale).
- * @note This function extracts a zip file to a specified directory and tracks the progress of the extraction.
+ * @brief Extract every entry of an opened zip handle to a directory.
+ * @note Takes ownership of zipfile and closes it before returning.
  */
-bool ExtractZippedArchive(const char* zipFilePath, const char* outputDirectory, double* overallProgress, double* fileProgress)
+static bool ExtractOpenedArchive(unzFile zipfile, const char* zipFilePath, const char* outputDirectory, std::atomic<double>* overallProgress, std::atomic<double>* fileProgress)
 {
-    std::cout << "[unzip] Extracting zip file: " << zipFilePath << " to " << outputDirectory << std::endl;
-
-    unzFile zipfile = unzOpen(zipFilePath);
-    if (!zipfile) {
-        std::cerr << "Error: Cannot open zip file " << zipFilePath << std::endl;
-        return false;
-    }
+    TRACE_SCOPE("ExtractZippedArchive", "unzip", outputDirectory);
 
     unz_global_info globalInfo;
     if (unzGetGlobalInfo(zipfile, &globalInfo) != UNZ_OK) {
@@ -148,6 +143,7 @@ bool ExtractZippedArchive(const char* zipFilePath, const char* outputDirectory,
         }
 
         const std::string strFileName = std::string(zStrFileName.data());
+        TRACE_SCOPE("ExtractEntry", "unzip", strFileName);
         std::cout << "[unzip] processing file #" << (currentFileIndex + 1) << " name='" << strFileName << "'\n";
 
         currentFileIndex++;
@@ -223,6 +219,7 @@ bool ExtractZippedArchive(const char* zipFilePath, const char* outputDirectory,
 
         fclose(outputFile);
         unzCloseCurrentFile(zipfile);
+        Trace::Counter("extractedBytes", static_cast<double>(currentFileBytesRead));
         std::cout << "[unzip] finished file '" << strFileName << "'\n";
     } while (unzGoToNextFile(zipfile) == UNZ_OK);
 
@@ -235,3 +232,59 @@ bool ExtractZippedArchive(const char* zipFilePath, const char* outputDirectory,
     unzClose(zipfile);
     return success;
 }
+
+/**
+ * @brief Extract a zipped archive to a directory.
+ * @param zipFilePath The path to the zip file.
+ * @param outputDirectory The directory to extract the zip file to.
+ * @param overallProgress Overall progress (0-1 scale), safe to read from another thread while extracting.
+ * @param fileProgress Progress of the current file (0-1 scale), safe to read from another thread while extracting.
+ * @note This function extracts a zip file to a specified directory and tracks the progress of the extraction.
+ */
+bool ExtractZippedArchive(const char* zipFilePath, const char* outputDirectory, std::atomic<double>* overallProgress, std::atomic<double>* fileProgress)
+{
+    std::cout << "[unzip] Extracting zip file: " << zipFilePath << " to " << outputDirectory << std::endl;
+
+    unzFile zipfile = unzOpen(zipFilePath);
+    if (!zipfile) {
+        std::cerr << "Error: Cannot open zip file " << zipFilePath << std::endl;
+        return false;
+    }
+
+    return ExtractOpenedArchive(zipfile, zipFilePath, outputDirectory, overallProgress, fileProgress);
+}
+
+/**
+ * @brief Extract a memory mapped archive to a directory.
+ * @note Each call wraps the shared mapping in its own read-only minizip memory stream, so concurrent
+ * extractions of the same archive to different directories never copy or re-read it.
+ */
+bool ExtractZippedArchive(const MappedFile& archive, const char* outputDirectory, std::atomic<double>* overallProgress, std::atomic<double>* fileProgress)
+{
+    std::cout << "[unzip] Extracting mapped archive (" << archive.size() << " bytes) to " << outputDirectory << std::endl;
+
+    if (!archive.data() || archive.size() > static_cast<size_t>(std::numeric_limits<int32_t>::max())) {
+        std::cerr << "Error: Mapped archive is empty or too large" << std::endl;
+        return false;
+    }
+
+    void* stream = mz_stream_mem_create();
+    if (!stream) {
+        std::cerr << "Error: Cannot create memory stream" << std::endl;
+        return false;
+    }
+
+    /** The buffer is only ever read; minizip takes a non-const pointer because the same stream type supports writing. */
+    mz_stream_mem_set_buffer(stream, const_cast<void*>(archive.data()), static_cast<int32_t>(archive.size()));
+    mz_stream_open(stream, nullptr, MZ_OPEN_MODE_READ);
+
+    /** unzClose() closes and deletes the stream, but never frees a buffer it didn't allocate */
+    unzFile zipfile = unzOpen_MZ(stream);
+    if (!zipfile) {
+        std::cerr << "Error: Cannot open mapped archive" << std::endl;
+        mz_stream_mem_delete(&stream);
+        return false;
+    }
+
+    return ExtractOpenedArchive(zipfile, "<mapped archive>", outputDirectory, overallProgress, fileProgress);
+}
@@ -34,13 +34,23 @@
 #include <GLFW/glfw3.h>
 #include <router.h>
 #include <renderer.h>
+#include <frame_scheduler.h>
+#include <frame_pacing.h>
 #include <wndproc.h>
 #include <dpi.h>
 #include <components.h>
 #include <i18n.h>
+#include <trace.h>
+#include <startup_profile.h>
+#include <perf_hud.h>
+#include <headless.h>
+#include <release_source.h>
+#include <updater.h>
 #include <iostream>
+#include <filesystem>
+#include <string>
 #include <thread>
-#include "updater.h"
+#include <cstdlib>
 
 #ifdef _WIN32
 void AllocateDeveloperConsoleIfNeeded()
@@ -59,10 +69,32 @@ void AllocateDeveloperConsoleIfNeeded()
 }
 #endif
 
+/**
+ * Look for --trace or --trace=<file> on the command line.
+ * @return The trace output path, or an empty string if tracing wasn't requested.
+ */
+std::string GetTraceOutputPath(int argc, char** argv)
+{
+    for (int i = 1; i < argc; i++) {
+        const std::string arg = argv[i];
+
+        if (arg == "--trace") {
+            return (std::filesystem::temp_directory_path() / "millennium-install-trace.json").string();
+        }
+        if (arg.rfind("--trace=", 0) == 0 && arg.size() > 8) {
+            return arg.substr(8);
+        }
+    }
+    return {};
+}
+
 int RunInstallerWindow(GLFWwindow* window)
 {
     IMGUI_CHECKVERSION();
-    ImGui::CreateContext();
+    {
+        STARTUP_PHASE("ImGui::CreateContext");
+        ImGui::CreateContext();
+    }
     ImGuiIO& io = ImGui::GetIO();
     io.ConfigFlags |= ImGuiConfigFlags_NavEnableKeyboard;
     io.ConfigFlags |= ImGuiConfigFlags_NavEnableGamepad;
@@ -73,8 +105,11 @@ int RunInstallerWindow(GLFWwindow* window)
 
     while (!glfwWindowShouldClose(window)) {
         glfwWaitEvents();
+        FrameScheduler::NotifyInput();
     }
 
+    /** Wake the renderer so it notices the window is closing */
+    FrameScheduler::RequestFrame();
     rendererThread.join();
 
     ImGui_ImplOpenGL3_Shutdown();
@@ -94,14 +129,25 @@ GLFWwindow* CreateWindowContext(GLFWmonitor* monitor)
     glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
     glfwWindowHint(GLFW_SAMPLES, 4);
 
-    GLFWwindow* window = glfwCreateWindow(WINDOW_WIDTH, WINDOW_HEIGHT, "Steam Homebrew", nullptr, nullptr);
+    STARTUP_PHASE("CreateWindowContext");
+    GLFWwindow* window = nullptr;
+    {
+        STARTUP_PHASE("glfwCreateWindow");
+        window = glfwCreateWindow(WINDOW_WIDTH, WINDOW_HEIGHT, "Steam Homebrew", nullptr, nullptr);
+    }
     if (window == nullptr) {
         glfwTerminate();
         return 0;
     }
 
-    SetupDPI(window);
-    SetWindowIcon(window);
+    {
+        STARTUP_PHASE("SetupDPI");
+        SetupDPI(window);
+    }
+    {
+        STARTUP_PHASE("SetWindowIcon");
+        SetWindowIcon(window);
+    }
 
     const GLFWvidmode* vidMode = glfwGetVideoMode(monitor);
     if (!vidMode) {
@@ -120,9 +166,11 @@ GLFWwindow* CreateWindowContext(GLFWmonitor* monitor)
     int posX = monitorX + (vidMode->width - (WINDOW_WIDTH * XDPI)) / 2;
     int posY = monitorY + (vidMode->height - (WINDOW_HEIGHT * YDPI)) / 2;
     glfwSetWindowPos(window, posX, posY);
+    FramePacing::SetRefreshRate(vidMode->refreshRate);
 
     glfwSetWindowRefreshCallback(window, WindowRefreshCallback);
     glfwSetFramebufferSizeCallback(window, FrameBufferSizeCallback);
+    glfwSetWindowPosCallback(window, WindowPosCallback);
     return window;
 }
 
@@ -130,23 +178,50 @@ GLFWwindow* CreateWindowContext(GLFWmonitor* monitor)
 int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPSTR lpCmdLine, int nCmdShow)
 {
     AllocateDeveloperConsoleIfNeeded();
-    Locale::Initialize();
-    CheckForAndDownloadUpdates();
+    StartupProfile::Initialize(__argc, __argv);
+    PerfHud::Initialize(__argc, __argv);
+    Trace::Initialize(GetTraceOutputPath(__argc, __argv));
+    Trace::SetThreadName("main");
+    ReleaseSource::Initialize(__argc, __argv);
+    {
+        STARTUP_PHASE("Locale::Initialize");
+        Locale::Initialize();
+    }
 
-    MMRESULT result = timeBeginPeriod(1);
-    if (result != TIMERR_NOERROR) {
-        std::cerr << "Failed to set timer resolution to 1 ms" << std::endl;
+    /** Unattended installs never touch GLFW/GL, and skip the self-update so scripted runs stay deterministic */
+    if (const auto headlessOptions = ParseHeadlessOptions(__argc, __argv)) {
+        return RunHeadlessInstall(*headlessOptions);
     }
+
+    /** Runs alongside window and font setup; a newer version is offered in the UI once it has downloaded */
+    Updater::BeginCheck();
 #else
 int main(int argc, char* argv[])
 {
-    Locale::Initialize();
+    StartupProfile::Initialize(argc, argv);
+    PerfHud::Initialize(argc, argv);
+    Trace::Initialize(GetTraceOutputPath(argc, argv));
+    Trace::SetThreadName("main");
+    ReleaseSource::Initialize(argc, argv);
+    {
+        STARTUP_PHASE("Locale::Initialize");
+        Locale::Initialize();
+    }
+
+    if (const auto headlessOptions = ParseHeadlessOptions(argc, argv)) {
+        return RunHeadlessInstall(*headlessOptions);
+    }
 #endif
 #if defined(__linux__)
     glfwInitHint(GLFW_PLATFORM, GLFW_PLATFORM_X11);
 #endif
     glfwSetErrorCallback(GLFWErrorCallback);
-    if (!glfwInit()) {
+    bool glfwInitialized = false;
+    {
+        STARTUP_PHASE("glfwInit");
+        glfwInitialized = glfwInit();
+    }
+    if (!glfwInitialized) {
 #ifdef _WIN32
         MessageBoxA(NULL, "Failed to initialize GLFW", "Error", MB_ICONERROR);
 #else
@@ -171,5 +246,12 @@ int main(int argc, char* argv[])
         return 1;
     }
 
-    return RunInstallerWindow(window);
+    const int exitCode = RunInstallerWindow(window);
+
+    /** A self-update download has no deadline; don't let it hold the closed window's process open */
+    if (Updater::IsRunning()) {
+        Trace::Flush();
+        std::_Exit(exitCode);
+    }
+    return exitCode;
 }
@@ -30,6 +30,7 @@
 
 #include <imgui.h>
 #include <animate.h>
+#include <frame_scheduler.h>
 #include <chrono>
 #include <texture.hh>
 #include <memory>
@@ -37,14 +38,16 @@
 #include <imgui_internal.h>
 #include <dpi.h>
 #include <unordered_map>
+#include <string_view>
+#include <functional>
+#include <cstdio>
 #include <components.h>
 #include <i18n.h>
-#include <atomic>
-#include <imspinner.h>
+#include <ui_events.h>
+#include <text_layout.h>
 #include <worker.h>
 
 using namespace ImGui;
-using namespace ImSpinner;
 
 enum OptionType
 {
@@ -55,9 +58,9 @@ enum OptionType
 
 struct OptionProps
 {
-    std::string id;           // stable key used for ImGui IDs and animation state
-    std::string title;
-    std::string description;
+    const char* id;           // stable key used for ImGui IDs and animation state
+    const char* title;
+    const char* description;
     OptionType type;
 };
 
@@ -68,15 +71,30 @@ struct OptionState
     float initPos;
 };
 
-std::unordered_map<std::string, OptionState> optionStates;
+/** Transparent hash, so looking an option up by its literal id never builds a std::string */
+struct OptionIdHash
+{
+    using is_transparent = void;
+
+    size_t operator()(std::string_view id) const
+    {
+        return std::hash<std::string_view>{}(id);
+    }
+};
+
+std::unordered_map<std::string, OptionState, OptionIdHash, std::equal_to<>> optionStates;
 static OptionType currentOption = UNSET;
 
-const void RenderOption(OptionProps props, int ContainerWidth, int ContainerHeight, int ContainerSpacing)
+const void RenderOption(const OptionProps& props, int ContainerWidth, int ContainerHeight, int ContainerSpacing)
 {
     ImGuiIO& io = GetIO();
     const float DEFAULT_BORDER_COL = GetStyleColorVec4(ImGuiCol_Border).x;
 
-    auto& state = optionStates[props.id];
+    auto it = optionStates.find(props.id);
+    if (it == optionStates.end()) {
+        it = optionStates.emplace(props.id, OptionState{}).first;
+    }
+    auto& state = it->second;
     state.initPos = GetCursorPosY();
 
     static const float hoverColor = 0.22f;
@@ -91,15 +109,18 @@ const void RenderOption(OptionProps props, int ContainerWidth, int ContainerHeig
         PushStyleColor(ImGuiCol_Border, ImVec4(currentClickedColor, currentClickedColor, currentClickedColor, 1.f));
     }
 
-    BeginChild(("##" + props.id + "Container").c_str(), ImVec2(ContainerWidth, ContainerHeight), true, ImGuiWindowFlags_NoScrollbar);
+    char containerId[64];
+    snprintf(containerId, sizeof(containerId), "##%sContainer", props.id);
+
+    BeginChild(containerId, ImVec2(ContainerWidth, ContainerHeight), true, ImGuiWindowFlags_NoScrollbar);
     {
         PushFont(io.Fonts->Fonts[1]);
-        Text("%s", props.title.c_str());
+        Text("%s", props.title);
         PopFont();
 
         Spacing();
         PushStyleColor(ImGuiCol_Text, ImVec4(0.422f, 0.425f, 0.441f, 1.0f));
-        TextWrapped("%s", props.description.c_str());
+        TextLayout::TextWrapped(props.description);
         PopStyleColor();
     }
     EndChild();
@@ -143,6 +164,7 @@ const float PollAnimationFrames(float navbarHeight, float windowHeight, float st
     static auto animationStartTime = std::chrono::steady_clock::now();
 
     if (shouldAnimate) {
+        FrameScheduler::RequestFrame();
         auto steadyClockNow = std::chrono::steady_clock::now();
         float elapsedTime = std::chrono::duration<float>(steadyClockNow - animationStartTime).count();
 
@@ -168,6 +190,11 @@ const void RenderHome(std::shared_ptr<RouterNav> router, float xPos)
 {
     ImGuiViewport* viewport = GetMainViewport();
 
+    /** Home is back at rest, so the user has left the uninstall page if they were on it */
+    if (xPos == 0.f) {
+        CancelUninstallerScan();
+    }
+
     const int BottomNavBarHeight = ScaleY(115);
     const int ContainerHeight = ScaleY(150); // ImGui Scaling manages DPI here.
     const int ContainerSpacing = ScaleX(30);
@@ -177,8 +204,8 @@ const void RenderHome(std::shared_ptr<RouterNav> router, float xPos)
 
     SetCursorPos({ xPos + (viewport->Size.x - ((ContainerWidth * 2) + ContainerSpacing)) / 2, ((viewport->Size.y - BottomNavBarHeight) / 2.0f) - ContainerHeight / 2.0f });
 
-    RenderOption({ "install", Locale::Get("homeInstall"), Locale::Get("homeInstallDesc"), INSTALL }, ContainerWidth, ContainerHeight, ContainerSpacing);
-    RenderOption({ "remove", Locale::Get("homeRemove"), Locale::Get("homeRemoveDesc"), REMOVE }, ContainerWidth, ContainerHeight, ContainerSpacing);
+    RenderOption({ "install", Locale::Get(LocaleKey::homeInstall), Locale::Get(LocaleKey::homeInstallDesc), INSTALL }, ContainerWidth, ContainerHeight, ContainerSpacing);
+    RenderOption({ "remove", Locale::Get(LocaleKey::homeRemove), Locale::Get(LocaleKey::homeRemoveDesc), REMOVE }, ContainerWidth, ContainerHeight, ContainerSpacing);
 
     PushStyleColor(ImGuiCol_ChildBg, ImVec4(0.078f, 0.082f, 0.09f, 1.0f));
 
@@ -199,10 +226,11 @@ const void RenderHome(std::shared_ptr<RouterNav> router, float xPos)
 
     RenderBottomNavBar("HomePanel", xPos, [xPos, router, viewport]
     {
-        static std::atomic<bool> isLoading{ false };
+        /** Cleared by the worker's completion event, so only the renderer thread touches it */
+        static bool isLoading = false;
         bool hasLoadedPushed = false;
 
-        if (currentOption == UNSET || isLoading.load(std::memory_order_relaxed)) {
+        if (currentOption == UNSET || isLoading) {
             PushStyleColor(ImGuiCol_Button, ImVec4(0.5f, 0.5f, 0.5f, 1.0f));
             PushStyleColor(ImGuiCol_ButtonHovered, ImVec4(0.5f, 0.5f, 0.5f, 1.0f));
             PushStyleColor(ImGuiCol_ButtonActive, ImVec4(0.5f, 0.5f, 0.5f, 1.0f));
@@ -210,7 +238,7 @@ const void RenderHome(std::shared_ptr<RouterNav> router, float xPos)
             hasLoadedPushed = true;
         }
 
-        if (isLoading.load(std::memory_order_relaxed)) {
+        if (isLoading) {
             PushStyleColor(ImGuiCol_ChildBg, ImVec4(0.6f, 0.6f, 0.6f, 1.0f));
             PushStyleVar(ImGuiStyleVar_ChildRounding, ScaleX(10.0f));
 
@@ -222,25 +250,29 @@ const void RenderHome(std::shared_ptr<RouterNav> router, float xPos)
                 const float spinnerSize = ScaleX(12.f);
                 SetCursorPos({ childWidth / 2 - spinnerSize, spinnerSize });
 
-                Spinner<SpinnerTypeT::e_st_ang>("SpinnerAngNoBg", Radius{ spinnerSize }, Thickness{ ScaleX(2) }, Color{ ImColor(0, 0, 0, 255) },
-                                                BgColor{ ImColor(255, 255, 255, 0) }, Speed{ 6 }, Angle{ IM_PI }, Mode{ 0 });
+                FrameScheduler::RequestFrame();
+                RenderSpinner("SpinnerAngNoBg", spinnerSize, ScaleX(2), ImVec4(0.f, 0.f, 0.f, 1.f));
             }
             EndChild();
             PopStyleColor();
             PopStyleVar();
-        } else if (Button(Locale::Get("homeNext"), { xPos + GetContentRegionAvail().x, GetContentRegionAvail().y })) {
+        } else if (Button(Locale::Get(LocaleKey::homeNext), { xPos + GetContentRegionAvail().x, GetContentRegionAvail().y })) {
             switch (currentOption) {
                 case INSTALL:
                 {
-                    isLoading.store(true, std::memory_order_relaxed);
+                    isLoading = true;
                     router->setComponents(InstallComponents);
 
                     const auto StartInstall = [router]()
                     {
-                        if (FetchVersionInfo()) {
-                            router->navigateNext();
-                        }
-                        isLoading.store(false, std::memory_order_relaxed);
+                        const bool fetched = FetchVersionInfo();
+                        UiEvents::Post([router, fetched]
+                        {
+                            if (fetched) {
+                                router->navigateNext();
+                            }
+                            isLoading = false;
+                        });
                     };
 
                     GetWorker().run(StartInstall);
@@ -248,14 +280,17 @@ const void RenderHome(std::shared_ptr<RouterNav> router, float xPos)
                 }
                 case REMOVE:
                 {
-                    isLoading.store(true, std::memory_order_relaxed);
+                    isLoading = true;
                     router->setComponents(UninstallComponents);
 
                     const auto StartUninstall = [router]()
                     {
                         InitializeUninstaller();
-                        router->navigateNext();
-                        isLoading.store(false, std::memory_order_relaxed);
+                        UiEvents::Post([router]
+                        {
+                            router->navigateNext();
+                            isLoading = false;
+                        });
                     };
 
                     GetWorker().run(StartUninstall);
@@ -275,15 +310,15 @@ const void RenderHome(std::shared_ptr<RouterNav> router, float xPos)
         const bool buttonHovered = IsItemHovered() || (IsItemHovered(ImGuiHoveredFlags_AllowWhenBlockedByActiveItem) && IsMouseDown(ImGuiMouseButton_Left));
 
         if (buttonHovered) {
-            if (currentOption == UNSET || isLoading.load(std::memory_order_relaxed)) {
+            if (currentOption == UNSET || isLoading) {
                 SetMouseCursor(ImGuiMouseCursor_NotAllowed);
             } else {
                 SetMouseCursor(ImGuiMouseCursor_Hand);
             }
         }
 
-        const char* toolTipText = Locale::Get("homeSelectOption");
-        const float tooltipWidth = CalcTextSize(toolTipText).x + ScaleX(20);
+        const char* toolTipText = Locale::Get(LocaleKey::homeSelectOption);
+        const float tooltipWidth = TextLayout::Measure(toolTipText).x + ScaleX(20);
 
         float toolTipOpacity = EaseInOutFloat("##SelectAnOptionTooltip", 0.f, 1.f, buttonHovered && currentOption == UNSET, 0.4f);
 
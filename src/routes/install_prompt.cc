@@ -42,10 +42,12 @@
 #include <i18n.h>
 #include <nlohmann/json.hpp>
 #include <http.h>
+#include <release_source.h>
 #include <util.h>
 #include <mini/ini.h>
 #include <format>
 #include <worker.h>
+#include <text_layout.h>
 
 using namespace ImGui;
 
@@ -67,7 +69,9 @@ static void UpdateSelectedRelease(const std::string& tag)
         if (release["tag_name"].get<std::string>() != tag)
             continue;
 
+        /** Nothing from the previously selected release may survive a release without a matching asset */
         selectedRelease = release;
+        osReleaseInfo = nlohmann::json();
         installSizeStr.clear();
 
         for (const auto& asset : selectedRelease["assets"]) {
@@ -78,7 +82,7 @@ static void UpdateSelectedRelease(const std::string& tag)
             }
             if (assetName == std::format("millennium-{}-windows-x86_64.installsize", tag)) {
                 if (asset.contains("browser_download_url")) {
-                    auto sizeResponse = Http::Get(asset["browser_download_url"].get<std::string>().c_str(), false);
+                    auto sizeResponse = ReleaseSource::GetAsset(asset["browser_download_url"].get<std::string>());
                     if (!sizeResponse.empty()) {
                         installSizeStr = sizeResponse;
                         // Trim whitespace
@@ -93,7 +97,7 @@ static void UpdateSelectedRelease(const std::string& tag)
             }
             if (assetName == std::format("millennium-{}-linux-x86_64.installsize", tag)) {
                 if (asset.contains("browser_download_url")) {
-                    auto sizeResponse = Http::Get(asset["browser_download_url"].get<std::string>().c_str(), false);
+                    auto sizeResponse = ReleaseSource::GetAsset(asset["browser_download_url"].get<std::string>());
                     if (!sizeResponse.empty()) {
                         installSizeStr = sizeResponse;
                         installSizeStr.erase(0, installSizeStr.find_first_not_of(" \t\n\r"));
@@ -110,6 +114,29 @@ static void UpdateSelectedRelease(const std::string& tag)
     }
 }
 
+/**
+ * Select a release from the list fetched by FetchVersionInfo().
+ * @return false if the tag doesn't exist or has no asset for this platform.
+ */
+const bool SelectReleaseByTag(const std::string& tag)
+{
+    UpdateSelectedRelease(tag);
+
+    if (!selectedRelease.contains("tag_name") || selectedRelease["tag_name"].get<std::string>() != tag) {
+        return false;
+    }
+    if (!osReleaseInfo.contains("name")) {
+        return false;
+    }
+#ifdef WIN32
+    return osReleaseInfo["name"].get<std::string>() == std::format("millennium-{}-windows-x86_64.zip", tag);
+#elif __linux__
+    return osReleaseInfo["name"].get<std::string>() == std::format("millennium-{}-linux-x86_64.tar.gz", tag);
+#else
+    return true;
+#endif
+}
+
 const bool FetchVersionInfo()
 {
     constexpr int MAX_PAGES = 50; // Safety limit (5000 releases max)
@@ -118,8 +145,8 @@ const bool FetchVersionInfo()
     releasesList = nlohmann::json::array();
 
     for (int page = 1; page <= MAX_PAGES; ++page) {
-        const auto url = std::format("https://api.github.com/repos/SteamClientHomebrew/Millennium/releases?per_page=100&page={}", page);
-        const auto response = Http::GetEx(url.c_str());
+        const auto path = std::format("/repos/SteamClientHomebrew/Millennium/releases?per_page=100&page={}", page);
+        const auto response = ReleaseSource::Get(path);
 
         if (response.isNetworkError()) {
             if (page == 1) {
@@ -184,7 +211,7 @@ const bool FetchVersionInfo()
             }
             if (assetName == std::format("millennium-{}-windows-x86_64.installsize", releaseTag)) {
                 if (asset.contains("browser_download_url")) {
-                    auto sizeResponse = Http::Get(asset["browser_download_url"].get<std::string>().c_str(), false);
+                    auto sizeResponse = ReleaseSource::GetAsset(asset["browser_download_url"].get<std::string>());
                     if (!sizeResponse.empty()) {
                         installSizeStr = sizeResponse;
                         installSizeStr.erase(0, installSizeStr.find_first_not_of(" \t\n\r"));
@@ -199,7 +226,7 @@ const bool FetchVersionInfo()
             }
             if (assetName == std::format("millennium-{}-linux-x86_64.installsize", releaseTag)) {
                 if (asset.contains("browser_download_url")) {
-                    auto sizeResponse = Http::Get(asset["browser_download_url"].get<std::string>().c_str(), false);
+                    auto sizeResponse = ReleaseSource::GetAsset(asset["browser_download_url"].get<std::string>());
                     if (!sizeResponse.empty()) {
                         installSizeStr = sizeResponse;
                         installSizeStr.erase(0, installSizeStr.find_first_not_of(" \t\n\r"));
@@ -249,7 +276,7 @@ const void RenderInstallPrompt(std::shared_ptr<RouterNav> router, float xPos)
     BeginChild("##PromptContainer", ImVec2(PromptContainerWidth, PromptContainerHeight), false);
     {
         PushFont(io.Fonts->Fonts[1]);
-        Text("%s", Locale::Get("installTitle"));
+        Text("%s", Locale::Get(LocaleKey::installTitle));
         PopFont();
 
         Spacing();
@@ -257,7 +284,7 @@ const void RenderInstallPrompt(std::shared_ptr<RouterNav> router, float xPos)
         // TextWrapped(std::format("Released {} • ", ToTimeAgo(releaseInfo["published_at"].get<std::string>())).c_str());
         // SameLine(0, ScaleX(5));
         // TextColored(ImVec4(0.408f, 0.525f, 0.91f, 1.0f), "view release notes");
-        Text("%s", Locale::Get("installSubtitle"));
+        Text("%s", Locale::Get(LocaleKey::installSubtitle));
 
         if (IsItemHovered()) {
             SetMouseCursor(ImGuiMouseCursor_Hand);
@@ -276,7 +303,7 @@ const void RenderInstallPrompt(std::shared_ptr<RouterNav> router, float xPos)
         Spacing();
         Spacing();
 
-        Text("%s", Locale::Get("installSteamPath"));
+        Text("%s", Locale::Get(LocaleKey::installSteamPath));
         Spacing();
         Spacing();
         PopStyleColor();
@@ -316,7 +343,7 @@ const void RenderInstallPrompt(std::shared_ptr<RouterNav> router, float xPos)
             PushStyleVar(ImGuiStyleVar_Alpha, currentColor);
             PushStyleColor(ImGuiCol_PopupBg, ImVec4(0.098f, 0.102f, 0.11f, 1.0f));
             BeginTooltip();
-            Text("%s", Locale::Get("installSelectPath"));
+            Text("%s", Locale::Get(LocaleKey::installSelectPath));
             EndTooltip();
             PopStyleVar(3);
             PopStyleColor();
@@ -331,11 +358,11 @@ const void RenderInstallPrompt(std::shared_ptr<RouterNav> router, float xPos)
         PushStyleColor(ImGuiCol_Text, ImVec4(0.422f, 0.425f, 0.441f, 1.0f));
 
         std::string currentTag = selectedRelease.contains("tag_name") ? selectedRelease["tag_name"].get<std::string>() : std::string("(none)");
-        { char buf[512]; snprintf(buf, sizeof(buf), Locale::Get("installVersion"), currentTag.c_str()); Text("%s", buf); }
+        { char buf[512]; snprintf(buf, sizeof(buf), Locale::Get(LocaleKey::installVersion), currentTag.c_str()); Text("%s", buf); }
         SameLine(0, ScaleX(5));
 
-        const char* changeText = Locale::Get("installChangeVersion");
-        ImVec2 changeSize = CalcTextSize(changeText);
+        const char* changeText = Locale::Get(LocaleKey::installChangeVersion);
+        ImVec2 changeSize = TextLayout::Measure(changeText);
         if (changeSize.y < GetTextLineHeight())
             changeSize.y = GetTextLineHeight();
 
@@ -372,7 +399,7 @@ const void RenderInstallPrompt(std::shared_ptr<RouterNav> router, float xPos)
 
                     if (latestReleaseTag == tag) {
                         PushStyleColor(ImGuiCol_Text, ImVec4(0.408f, 0.525f, 0.91f, 1.0f));
-                        strTag += Locale::Get("installLatest");
+                        strTag += Locale::Get(LocaleKey::installLatest);
                     }
 
                     if (Selectable(std::format("  {}  ", strTag).c_str(), is_selected)) {
@@ -404,12 +431,12 @@ const void RenderInstallPrompt(std::shared_ptr<RouterNav> router, float xPos)
         PushStyleColor(ImGuiCol_Text, ImVec4(0.422f, 0.425f, 0.441f, 1.0f));
 
         if (installSizeStr.empty()) {
-            Text("%s", Locale::Get("installSizeNA"));
+            Text("%s", Locale::Get(LocaleKey::installSizeNA));
         } else {
-            { char buf[256]; snprintf(buf, sizeof(buf), Locale::Get("installSizeMB"), stof(installSizeStr) / (1024.0f * 1024.0f)); Text("%s", buf); }
+            { char buf[256]; snprintf(buf, sizeof(buf), Locale::Get(LocaleKey::installSizeMB), stof(installSizeStr) / (1024.0f * 1024.0f)); Text("%s", buf); }
         }
 
-        { char buf[256]; snprintf(buf, sizeof(buf), Locale::Get("installDownloadMB"), osReleaseInfo.contains("size") ? osReleaseInfo["size"].get<float>() / (1024.0f * 1024.0f) : 0.0f); Text("%s", buf); }
+        { char buf[256]; snprintf(buf, sizeof(buf), Locale::Get(LocaleKey::installDownloadMB), osReleaseInfo.contains("size") ? osReleaseInfo["size"].get<float>() / (1024.0f * 1024.0f) : 0.0f); Text("%s", buf); }
 
         PopStyleColor();
     }
@@ -424,7 +451,7 @@ const void RenderInstallPrompt(std::shared_ptr<RouterNav> router, float xPos)
         PushStyleColor(ImGuiCol_Button, ImVec4(currentColor, currentColor, currentColor, 1.0f));
         PushStyleColor(ImGuiCol_ButtonHovered, ImVec4(currentColor, currentColor, currentColor, 1.0f));
 
-        if (Button(Locale::Get("installButton"), ImVec2(xPos + GetContentRegionAvail().x, GetContentRegionAvail().y))) {
+        if (Button(Locale::Get(LocaleKey::installButton), ImVec2(xPos + GetContentRegionAvail().x, GetContentRegionAvail().y))) {
             auto path = steamPath;
             auto release = selectedRelease;
             auto osRelease = osReleaseInfo;
@@ -34,9 +34,9 @@
 #include <string>
 #include <chrono>
 #include <animate.h>
+#include <frame_scheduler.h>
 #include <texture.hh>
 #include <imgui_stdlib.h>
-#include <imspinner.h>
 #include <dpi.h>
 #include <worker.h>
 #include <i18n.h>
@@ -45,16 +45,26 @@
 #include <http.h>
 #include <task_scheduler.h>
 #include <unzip.h>
+#include <trace.h>
+#include <archive_cache.h>
+#include <release_source.h>
+#include <algorithm>
 #include <atomic>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <components.h>
+#include <ui_events.h>
+#include <text_layout.h>
 #ifdef _WIN32
 #include <windows.h>
 #include <tlhelp32.h>
 #endif
 
 using namespace ImGui;
-using namespace ImSpinner;
 
-static std::string statusText;
+/** Set by the install tasks through UiEvents; points into the locale tables */
+static const char* statusText = "";
 
 float progress = 0.0f;
 static float easedProgress = 0.0f;
@@ -77,6 +87,7 @@ void UpdateProgressEasing()
     float elapsedTime = std::chrono::duration<float>(now - transitionStartTime).count();
 
     if (elapsedTime < TRANSITION_DURATION) {
+        FrameScheduler::RequestFrame();
         float t = elapsedTime / TRANSITION_DURATION;
         easedProgress = startProgress + (targetProgress - startProgress) * EaseInOut(t);
     } else {
@@ -116,6 +127,7 @@ bool SecureCompareBytes(const BYTE* a, const BYTE* b, size_t length)
 
 bool VerifyDownloadSignature(const std::string& file, const std::string& expected_hex)
 {
+    TRACE_SCOPE("VerifyDownloadSignature", "hash", file);
     std::vector<BYTE> expected_hash = HexStringToBytes(expected_hex);
     if (expected_hash.empty() || expected_hash.size() != 32) {
         return false;
@@ -173,8 +185,9 @@ cleanup:
 #include <openssl/evp.h>
 #include <cstdio>
 
-static bool VerifyDownloadSignature(const std::string& filePath, const std::string& expectedHex)
+bool VerifyDownloadSignature(const std::string& filePath, const std::string& expectedHex)
 {
+    TRACE_SCOPE("VerifyDownloadSignature", "hash", filePath);
     FILE* f = fopen(filePath.c_str(), "rb");
     if (!f) return false;
 
@@ -207,60 +220,188 @@ static bool VerifyDownloadSignature(const std::string& filePath, const std::stri
 }
 #endif
 
+/** Verified archive to extract, either a cache entry or a fresh download that couldn't be cached */
+static std::filesystem::path releaseArchivePath;
+
 TaskScheduler::TaskResult DownloadReleaseAssets(std::unique_ptr<double>& progress, const nlohmann::json& releaseInfo, const nlohmann::json& osReleaseInfo)
 {
     /** Update the progress text */
-    statusText = Locale::Get("installerDownloading");
+    UiEvents::Post([] { statusText = Locale::Get(LocaleKey::installerDownloading); });
 
     const auto fileSize = osReleaseInfo["size"].get<double>();
     const auto downloadUrl = osReleaseInfo["browser_download_url"].get<std::string>();
     const auto expectedSignature = osReleaseInfo["digest"].get<std::string>();
+    const auto expectedDigest = expectedSignature.substr(7);
+
+    /** Reinstalls, repairs and downgrades to a previously installed version don't need the network */
+    if (const auto cached = ArchiveCache::Lookup(expectedDigest)) {
+        if (VerifyDownloadSignature(cached->string(), expectedDigest)) {
+            releaseArchivePath = *cached;
+            *progress = 1.0;
+            return { true, "success" };
+        }
+
+        std::cerr << "[installer] cached archive failed verification, downloading again" << std::endl;
+        ArchiveCache::Remove(expectedDigest);
+    }
+
     /** Download to the temp directory */
     const auto fileName = std::filesystem::temp_directory_path() / osReleaseInfo["name"].get<std::string>();
 
-    if (!Http::downloadFile(downloadUrl, fileName.string(), fileSize, [&progress](double downloaded, double total) { *progress = downloaded / total; }, true)) {
+    if (!ReleaseSource::DownloadFile(downloadUrl, fileName.string(), fileSize, [&progress](double downloaded, double total) { *progress = downloaded / total; }, true)) {
         std::cout << "Download failed" << std::endl;
         return { false, "Failed to download release assets." };
     }
 
-    if (!VerifyDownloadSignature(fileName.string(), expectedSignature.substr(7))) {
+    if (!VerifyDownloadSignature(fileName.string(), expectedDigest)) {
         std::filesystem::remove(fileName);
         return { false, "Downloaded file signature does not match expected signature." };
     }
 
+    releaseArchivePath = ArchiveCache::Store(fileName, expectedDigest).value_or(fileName);
     return { true, "success" };
 }
 
-TaskScheduler::TaskResult InstallReleaseAssets(std::unique_ptr<double>& progress, const nlohmann::json& releaseInfo, const nlohmann::json& osReleaseInfo,
-                                               const std::string& steamPath)
+static std::mutex installTargetsMutex;
+static std::vector<InstallTarget> installTargets;
+
+std::vector<InstallTarget> GetInstallTargets()
+{
+    std::lock_guard<std::mutex> lock(installTargetsMutex);
+    return installTargets;
+}
+
+TaskScheduler::TaskResult InstallReleaseAssets(std::unique_ptr<double>& progress, const nlohmann::json& releaseInfo, const nlohmann::json& osReleaseInfo)
 {
     /** Update the progress text */
-    statusText = Locale::Get("installerInstalling");
+    UiEvents::Post([] { statusText = Locale::Get(LocaleKey::installerInstalling); });
 
-    const auto fileName = std::filesystem::temp_directory_path() / osReleaseInfo["name"].get<std::string>();
-    double currentFileProgress = 0.0;
+    /** Map the verified archive once; every target extracts from the same read-only pages */
+    MappedFile archive;
+    if (!archive.open(releaseArchivePath)) {
+        return { false, "Failed to open the downloaded release assets." };
+    }
+
+    /** Written by each extractor and read by the polling loop below, so every target gets its own atomic */
+    const size_t targetCount = GetInstallTargets().size();
+    std::vector<std::atomic<double>> targetProgress(targetCount);
+    std::atomic<size_t> remaining{ targetCount };
+    std::vector<std::thread> extractors;
+    extractors.reserve(targetCount);
+
+    for (size_t i = 0; i < targetCount; i++) {
+        extractors.emplace_back([&, i]()
+        {
+            const std::string threadName = "extract-" + std::to_string(i);
+            Trace::SetThreadName(threadName.c_str());
 
-    if (!ExtractZippedArchive(fileName.string().c_str(), steamPath.c_str(), progress.get(), &currentFileProgress)) {
+            std::string steamPath;
+            {
+                std::lock_guard<std::mutex> lock(installTargetsMutex);
+                steamPath = installTargets[i].steamPath;
+            }
+
+            std::atomic<double> currentFileProgress{ 0.0 };
+            const bool success = ExtractZippedArchive(archive, steamPath.c_str(), &targetProgress[i], &currentFileProgress);
+
+            {
+                std::lock_guard<std::mutex> lock(installTargetsMutex);
+                installTargets[i].finished = true;
+                installTargets[i].success = success;
+                installTargets[i].message = success ? "success" : "Failed to extract release assets. The download may be corrupt or the disk may be full.";
+            }
+            remaining--;
+        });
+    }
+
+    /** Overall progress is the mean of all targets; per-target progress is published for GetInstallTargets() */
+    while (true) {
+        const bool done = remaining.load() == 0;
+        double total = 0.0;
+        {
+            std::lock_guard<std::mutex> lock(installTargetsMutex);
+            for (size_t i = 0; i < targetCount; i++) {
+                installTargets[i].progress = targetProgress[i].load(std::memory_order_relaxed);
+                total += installTargets[i].progress;
+            }
+        }
+        *progress = targetCount ? total / static_cast<double>(targetCount) : 1.0;
+
+        if (done) {
+            break;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    }
+
+    for (auto& extractor : extractors) {
+        extractor.join();
+    }
+
+    std::vector<std::string> failedPaths;
+    for (const auto& target : GetInstallTargets()) {
+        if (!target.success) {
+            failedPaths.push_back(target.steamPath);
+        }
+    }
+
+    if (failedPaths.empty()) {
+        return { true, "success" };
+    }
+
+    if (targetCount == 1) {
         return { false, "Failed to extract release assets. The download may be corrupt or the disk may be full." };
     }
 
-    return { true, "success" };
+    std::string reason = "Failed to extract release assets to " + std::to_string(failedPaths.size()) + " of " + std::to_string(targetCount) + " Steam folders:";
+    for (const auto& path : failedPaths) {
+        reason += " " + path;
+    }
+    return { false, reason };
 }
 
-std::atomic<bool> hasTaskSchedulerFinished{ false };
+/** Renderer thread only, set by the completion event OnFinishInstall() posts */
+static bool hasTaskSchedulerFinished = false;
 
 void OnFinishInstall()
 {
-    hasTaskSchedulerFinished.store(true);
+    UiEvents::Post([] { hasTaskSchedulerFinished = true; });
 }
 
 std::string g_steamPath;
 
 void StartInstaller(std::string steamPath, nlohmann::json releaseInfo, nlohmann::json osReleaseInfo)
 {
+    StartInstaller(std::vector<std::string>{ steamPath }, releaseInfo, osReleaseInfo);
+}
+
+void StartInstaller(std::vector<std::string> steamPaths, nlohmann::json releaseInfo, nlohmann::json osReleaseInfo)
+{
+    Trace::SetThreadName("worker");
     KillSteamProcess();
 
-    g_steamPath = steamPath;
+    g_steamPath = steamPaths.empty() ? std::string() : steamPaths.front();
+
+    /** The same Steam root given twice (or through a symlink) would get two extractors writing the same files */
+    {
+        std::lock_guard<std::mutex> lock(installTargetsMutex);
+        installTargets.clear();
+
+        std::vector<std::filesystem::path> canonicalPaths;
+        for (const auto& steamPath : steamPaths) {
+            std::error_code ec;
+            std::filesystem::path canonicalPath = std::filesystem::weakly_canonical(steamPath, ec);
+            if (ec) {
+                canonicalPath = std::filesystem::absolute(steamPath, ec).lexically_normal();
+            }
+
+            if (std::find(canonicalPaths.begin(), canonicalPaths.end(), canonicalPath) != canonicalPaths.end()) {
+                std::cout << "[installer] skipping duplicate Steam path '" << steamPath << "'" << std::endl;
+                continue;
+            }
+            canonicalPaths.push_back(std::move(canonicalPath));
+            installTargets.push_back({ steamPath });
+        }
+    }
 
     progress = 0.0f;
     easedProgress = 0.0f;
@@ -268,11 +409,13 @@ void StartInstaller(std::string steamPath, nlohmann::json releaseInfo, nlohmann:
 
     std::cout << "[installer] scheduling download + install tasks" << std::endl;
     scheduler->addTask(std::bind(DownloadReleaseAssets, std::placeholders::_1, releaseInfo, osReleaseInfo));
-    scheduler->addTask(std::bind(InstallReleaseAssets, std::placeholders::_1, releaseInfo, osReleaseInfo, steamPath));
+    scheduler->addTask(std::bind(InstallReleaseAssets, std::placeholders::_1, releaseInfo, osReleaseInfo));
     std::cout << "[installer] running scheduler" << std::endl;
     scheduler->run();
     std::cout << "[installer] scheduler.run() returned" << std::endl;
 
+    Trace::Flush();
+
     std::cout << "[installer] calling OnFinishInstall()" << std::endl;
     OnFinishInstall();
 }
@@ -282,11 +425,11 @@ void RenderFailed(float xPos, const std::string& reason)
     ImGuiIO& io = GetIO();
     ImGuiViewport* viewport = GetMainViewport();
 
-    const char* text = Locale::Get("installerFailTitle");
-    const char* subDescription = Locale::Get("installerTroubleshoot");
+    const char* text = Locale::Get(LocaleKey::installerFailTitle);
+    const char* subDescription = Locale::Get(LocaleKey::installerTroubleshoot);
 
     PushFont(io.Fonts->Fonts[1]);
-    SetCursorPos({ xPos + (viewport->Size.x) / 2 - (CalcTextSize(text).x / 2), viewport->Size.y / 2 - ScaleY(55) });
+    SetCursorPos({ xPos + (viewport->Size.x) / 2 - (TextLayout::Measure(text).x / 2), viewport->Size.y / 2 - ScaleY(55) });
     Text("%s", text);
     PopFont();
 
@@ -296,7 +439,7 @@ void RenderFailed(float xPos, const std::string& reason)
     PopStyleColor();
 
     PushStyleColor(ImGuiCol_Text, ImVec4(0.408f, 0.525f, 0.91f, 1.0f));
-    SetCursorPos({ xPos + (viewport->Size.x) / 2 - (CalcTextSize(subDescription).x / 2), viewport->Size.y / 2 + ScaleY(20) });
+    SetCursorPos({ xPos + (viewport->Size.x) / 2 - (TextLayout::Measure(subDescription).x / 2), viewport->Size.y / 2 + ScaleY(20) });
     Text("%s", subDescription);
     PopStyleColor();
 
@@ -312,7 +455,12 @@ const void RenderInstaller(std::shared_ptr<RouterNav> router, float xPos)
 {
     progress = scheduler->getProgress();
     bool hasFailed = scheduler->hasFailed();
-    std::string failureReason = scheduler->getFailureReason();
+
+    /** Copied once when the install fails rather than every frame */
+    static std::string failureReason;
+    if (hasFailed && failureReason.empty()) {
+        failureReason = scheduler->getFailureReason();
+    }
 
     router->setCanGoBack(false);
     UpdateProgressEasing();
@@ -336,7 +484,7 @@ const void RenderInstaller(std::shared_ptr<RouterNav> router, float xPos)
     static const int progressBarWidth = ScaleX(300);
 
     if (hasFailed) {
-        hasTaskSchedulerFinished.store(true);
+        hasTaskSchedulerFinished = true;
         easedProgress = 1.0f;
         RenderFailed(xPos, failureReason);
     } else {
@@ -345,33 +493,33 @@ const void RenderInstaller(std::shared_ptr<RouterNav> router, float xPos)
             // router->setCanGoBack(true);
             SetCursorPos({ xPos + (viewport->Size.x / 2) - static_cast<float>(spinnerSize), (viewport->Size.y / 2) - 50 });
             {
-                Spinner<SpinnerTypeT::e_st_ang>("SpinnerAngNoBg", Radius{ static_cast<float>(spinnerSize) }, Thickness{ ScaleX(3) }, Color{ ImColor(255, 255, 255, 255) },
-                                                BgColor{ ImColor(255, 255, 255, 0) }, Speed{ 6.0f }, Angle{ IM_PI }, Mode{ 0 });
+                FrameScheduler::RequestFrame();
+                RenderSpinner("SpinnerAngNoBg", static_cast<float>(spinnerSize), ScaleX(3), ImVec4(1.f, 1.f, 1.f, 1.f));
             }
             SetCursorPos({ xPos + ((viewport->Size.x - static_cast<float>(progressBarWidth)) / 2), viewport->Size.y / 2 + ScaleY(60) });
             {
                 ProgressBar(easedProgress, { static_cast<float>(progressBarWidth), ScaleY(4.0f) }, "##ProgressBar");
             }
 
-            SetCursorPos({ xPos + (viewport->Size.x) / 2 - (CalcTextSize(statusText.c_str()).x / 2), viewport->Size.y / 2 + ScaleY(15) });
-            Text("%s", statusText.c_str());
+            SetCursorPos({ xPos + (viewport->Size.x) / 2 - (TextLayout::Measure(statusText).x / 2), viewport->Size.y / 2 + ScaleY(15) });
+            Text("%s", statusText);
         } else {
-            const char* text = Locale::Get("installerSuccessTitle");
-            const char* description = Locale::Get("installerSuccessDesc");
-            const char* subDescription = Locale::Get("installerDocs");
+            const char* text = Locale::Get(LocaleKey::installerSuccessTitle);
+            const char* description = Locale::Get(LocaleKey::installerSuccessDesc);
+            const char* subDescription = Locale::Get(LocaleKey::installerDocs);
 
             PushFont(io.Fonts->Fonts[1]);
-            SetCursorPos({ xPos + (viewport->Size.x) / 2 - (CalcTextSize(text).x / 2), viewport->Size.y / 2 - ScaleY(55) });
+            SetCursorPos({ xPos + (viewport->Size.x) / 2 - (TextLayout::Measure(text).x / 2), viewport->Size.y / 2 - ScaleY(55) });
             Text("%s", text);
             PopFont();
 
             PushStyleColor(ImGuiCol_Text, ImVec4(0.4f, 0.4f, 0.4f, 1.0f));
-            SetCursorPos({ xPos + (viewport->Size.x) / 2 - (CalcTextSize(description).x / 2), viewport->Size.y / 2 - ScaleY(15) });
+            SetCursorPos({ xPos + (viewport->Size.x) / 2 - (TextLayout::Measure(description).x / 2), viewport->Size.y / 2 - ScaleY(15) });
             Text("%s", description);
             PopStyleColor();
 
             PushStyleColor(ImGuiCol_Text, ImVec4(0.408f, 0.525f, 0.91f, 1.0f));
-            SetCursorPos({ xPos + (viewport->Size.x) / 2 - (CalcTextSize(subDescription).x / 2), viewport->Size.y / 2 + ScaleY(20) });
+            SetCursorPos({ xPos + (viewport->Size.x) / 2 - (TextLayout::Measure(subDescription).x / 2), viewport->Size.y / 2 + ScaleY(20) });
             Text("%s", subDescription);
             PopStyleColor();
 
@@ -384,14 +532,15 @@ const void RenderInstaller(std::shared_ptr<RouterNav> router, float xPos)
         }
     }
 
-    if (hasTaskSchedulerFinished.load()) {
+    if (hasTaskSchedulerFinished) {
         isWaitingForProgressComplete = true;
         /** Reset the flag so it doesn't restart each frame */
-        hasTaskSchedulerFinished.store(false);
+        hasTaskSchedulerFinished = false;
     }
 
     /** Wait for progress bar animation to complete, then wait 0.5 seconds before showing the complete modal */
     if (isWaitingForProgressComplete && !shouldRenderCompleteModal) {
+        FrameScheduler::RequestFrame();
         if (easedProgress >= 0.99f) {
             static bool timerStarted = false;
             if (!timerStarted) {
@@ -415,6 +564,7 @@ const void RenderInstaller(std::shared_ptr<RouterNav> router, float xPos)
     static const float ANIMATION_DURATION = 0.3f;
 
     if (shouldAnimate) {
+        FrameScheduler::RequestFrame();
         auto now = std::chrono::steady_clock::now();
         float elapsedTime = std::chrono::duration<float>(now - animationStartTime).count();
 
@@ -440,16 +590,16 @@ const void RenderInstaller(std::shared_ptr<RouterNav> router, float xPos)
     BeginChild("##BottomNavBar", { viewport->Size.x, BottomNavBarHeight - 3 }, true, ImGuiWindowFlags_NoScrollbar);
     {
         SetCursorPos({ ScaleX(45), GetCursorPosY() + ScaleY(12.5) });
-        Image((ImTextureID)(intptr_t)infoIconTexture, { ScaleX(25), ScaleY(25) });
+        DrawIcon(Icon::Info, { ScaleX(25), ScaleY(25) });
 
         SameLine(0, ScaleX(42));
         const float cursorPosSave = GetCursorPosX();
 
         SetCursorPosY(GetCursorPosY() - ScaleY(12));
-        TextColored(ImVec4(0.322f, 0.325f, 0.341f, 1.0f), "%s", Locale::Get("installerDisclaimer1"));
+        TextColored(ImVec4(0.322f, 0.325f, 0.341f, 1.0f), "%s", Locale::Get(LocaleKey::installerDisclaimer1));
 
         SetCursorPos({ cursorPosSave, GetCursorPosY() - ScaleY(20) });
-        TextColored(ImVec4(0.322f, 0.325f, 0.341f, 1.0f), "%s", Locale::Get("installerDisclaimer2"));
+        TextColored(ImVec4(0.322f, 0.325f, 0.341f, 1.0f), "%s", Locale::Get(LocaleKey::installerDisclaimer2));
 
         SameLine(0);
         SetCursorPosY(GetCursorPosY() - ScaleY(25));
@@ -467,7 +617,7 @@ const void RenderInstaller(std::shared_ptr<RouterNav> router, float xPos)
 
         SetCursorPosX(xPos + GetCursorPosX() + GetContentRegionAvail().x - ButtonWidth);
 
-        if (Button(Locale::Get("installerFinish"), { xPos + GetContentRegionAvail().x, GetContentRegionAvail().y })) {
+        if (Button(Locale::Get(LocaleKey::installerFinish), { xPos + GetContentRegionAvail().x, GetContentRegionAvail().y })) {
             StartSteamFromPath(g_steamPath);
         }
 
@@ -31,8 +31,11 @@
 #include <vector>
 #include <imgui.h>
 #include <router.h>
+#include <frame_scheduler.h>
 #include <math.h>
 
+using namespace ImGui;
+
 float easeInOut(float t)
 {
     return t < 0.5f ? 4.0f * t * t * t : 1.0f - pow(-2.0f * t + 2.0f, 3) / 2.0f;
@@ -78,15 +81,79 @@ void RouterNav::update()
 {
     float deltaTime = ImGui::GetIO().DeltaTime;
     if (isAnimating) {
+        FrameScheduler::RequestFrame();
         animTime += deltaTime / animationDuration;
         if (animTime >= 1.0f) {
             animTime = 1.0f;
             isAnimating = false;
             currentIndex = targetIndex;
+            outgoingSnapshot.clear();
         }
     }
 }
 
+/** Whether any part of a full-width panel drawn at `offset` lands inside the viewport */
+static bool IsOnScreen(float offset, float viewportWidth)
+{
+    return fabsf(offset) < viewportWidth - 0.5f;
+}
+
+void RouterNav::render(float viewportWidth)
+{
+    const float currentOffset = getCurrentOffset(viewportWidth);
+    const float transitioningOffset = getTransitioningOffset(viewportWidth);
+
+    if (isAnimating && IsOnScreen(transitioningOffset, viewportWidth)) {
+        renderComponent(targetIndex, transitioningOffset);
+    }
+
+    SameLine();
+
+    if (!IsOnScreen(currentOffset, viewportWidth)) {
+        return;
+    }
+
+    if (isAnimating) {
+        renderOutgoing(currentOffset);
+    } else {
+        renderComponent(currentIndex, currentOffset);
+    }
+}
+
+/**
+ * Each route gets the same ID scope whether it is sliding in or current, so widget and tween state keyed on the ID
+ * stack carries over when the slide ends.
+ */
+void RouterNav::renderComponent(size_t index, float xOffset)
+{
+    PushID(static_cast<int>(index));
+    components[index](shared_from_this(), xOffset);
+    PopID();
+}
+
+/** The current route while it slides away: recorded on the first frame, replayed at the new offset on the rest */
+void RouterNav::renderOutgoing(float xOffset)
+{
+    if (outgoingState == SnapshotState::Ready) {
+        /** Whole pixels only, so text stays on the pixel grid it was laid out on */
+        if (outgoingSnapshot.replay(roundf(xOffset - outgoingSnapshotOffset))) {
+            return;
+        }
+        outgoingSnapshot.clear();
+        outgoingState = SnapshotState::Unavailable;
+    }
+
+    if (outgoingState == SnapshotState::Pending) {
+        outgoingSnapshot.begin();
+        renderComponent(currentIndex, xOffset);
+        outgoingState = outgoingSnapshot.end() ? SnapshotState::Ready : SnapshotState::Unavailable;
+        outgoingSnapshotOffset = xOffset;
+        return;
+    }
+
+    renderComponent(currentIndex, xOffset);
+}
+
 float RouterNav::getCurrentOffset(float viewportWidth) const
 {
     return isAnimating ? lerp(0.0f, -viewportWidth * animDirection, easeInOut(animTime)) : 0.0f;
@@ -108,4 +175,7 @@ void RouterNav::startAnimation(int direction)
     animTime = 0.0f;
     animDirection = direction;
     targetIndex = currentIndex + direction;
+
+    outgoingSnapshot.clear();
+    outgoingState = SnapshotState::Pending;
 }
@@ -30,6 +30,7 @@
 
 #include <imgui.h>
 #include <animate.h>
+#include <frame_scheduler.h>
 #include <chrono>
 #include <texture.hh>
 #include <imgui_stdlib.h>
@@ -41,12 +42,14 @@
 #include <components.h>
 #include <i18n.h>
 #include <filesystem>
-#include <imspinner.h>
 #include <util.h>
 #include <worker.h>
+#include <ui_events.h>
+#include <text_layout.h>
+#include <size_scanner.h>
+#include <tree_remover.h>
 
 using namespace ImGui;
-using namespace ImSpinner;
 
 static std::filesystem::path steamPath;
 
@@ -54,6 +57,19 @@ struct ComponentProps
 {
     float byteSize;
     std::vector<std::string> pathList;
+
+    /** Tooltip listing pathList, one path per line */
+    std::string pathListText;
+
+    /** "<name>: <size>", rebuilt by GetComponentLabel() only when the localized name or the size changes */
+    std::string label;
+    const char* labelName = nullptr;
+    float labelByteSize = -1.f;
+
+    /** "<name>: <removed> of <size> removed (...)" while uninstalling, rebuilt by GetProgressLabel() as counts change */
+    std::string progressLabel;
+    const char* progressLabelName = nullptr;
+    TreeRemover::Counts progressLabelCounts{ UINT64_MAX, UINT64_MAX };
 };
 
 bool isUninstalling = false;
@@ -75,6 +91,10 @@ struct ComponentState
 
         std::optional<std::string> errorMessage;
         State state;
+
+        /** Live counts from the removal, and how many files the component held when it started */
+        TreeRemover::Counts removed;
+        uint64_t totalFiles = 0;
     };
 
     UninstallState uninstallState;
@@ -84,40 +104,100 @@ struct ComponentState
     }
 };
 
+/** Sizes start at zero and are filled in by the size scan once the page is shown */
 ComponentProps MakeComponentProps(std::vector<std::filesystem::path> pathList)
 {
-    uint64_t byteSize = 0;
-
-    for (const auto& path : pathList) {
-        std::error_code ec;
-        byteSize += GetFolderSize(path, ec);
-    }
-
     std::vector<std::string> pathListStr;
+    std::string pathListText;
 
     for (const auto& path : pathList) {
         if (!std::filesystem::exists(path)) {
             continue;
         }
         pathListStr.push_back(path.string());
+        pathListText += pathListStr.back() + "\n";
     }
 
-    return { static_cast<float>(byteSize), pathListStr };
+    return { 0.f, std::move(pathListStr), std::move(pathListText) };
 }
 
 std::vector<std::pair<std::string, std::tuple<ComponentState, ComponentProps>>> uninstallComponents;
 
+/** Renderer thread. Set by InitializeUninstaller() so the next draw of the page starts sizing the new component list */
+static bool isSizeScanPending = false;
+static std::unique_ptr<SizeScan> sizeScan;
+/** Bumped whenever a scan starts or is dropped, so totals a dropped scan already posted are ignored */
+static uint64_t sizeScanGeneration = 0;
+
+static void StartSizeScan()
+{
+    std::vector<std::vector<std::filesystem::path>> groups;
+    for (const auto& componentPair : uninstallComponents) {
+        const auto& props = std::get<1>(componentPair.second);
+        groups.emplace_back(props.pathList.begin(), props.pathList.end());
+    }
+
+    const uint64_t generation = ++sizeScanGeneration;
+    sizeScan = std::make_unique<SizeScan>(std::move(groups), [generation](const std::vector<uint64_t>& totals, bool)
+    {
+        UiEvents::Post([generation, totals]
+        {
+            if (generation != sizeScanGeneration) {
+                return;
+            }
+            for (size_t i = 0; i < totals.size() && i < uninstallComponents.size(); i++) {
+                std::get<1>(uninstallComponents[i].second).byteSize = static_cast<float>(totals[i]);
+            }
+        });
+    });
+}
+
+void CancelUninstallerScan()
+{
+    if (!sizeScan) {
+        return;
+    }
+    sizeScan.reset();
+    sizeScanGeneration++;
+}
+
 /** Map stable internal IDs to locale keys */
 static const char* GetComponentLocaleName(const std::string& id)
 {
-    if (id == "Millennium")              return Locale::Get("componentMillennium");
-    if (id == "Custom Steam Components") return Locale::Get("componentCustomSteam");
-    if (id == "Dependencies")            return Locale::Get("componentDependencies");
-    if (id == "Themes")                  return Locale::Get("componentThemes");
-    if (id == "Plugins")                 return Locale::Get("componentPlugins");
+    if (id == "Millennium")              return Locale::Get(LocaleKey::componentMillennium);
+    if (id == "Custom Steam Components") return Locale::Get(LocaleKey::componentCustomSteam);
+    if (id == "Dependencies")            return Locale::Get(LocaleKey::componentDependencies);
+    if (id == "Themes")                  return Locale::Get(LocaleKey::componentThemes);
+    if (id == "Plugins")                 return Locale::Get(LocaleKey::componentPlugins);
     return id.c_str();
 }
 
+static const std::string& GetComponentLabel(const std::string& id, ComponentProps& props)
+{
+    const char* name = GetComponentLocaleName(id);
+    if (name != props.labelName || props.byteSize != props.labelByteSize) {
+        props.label = std::string(name) + ": " + BytesToReadableFormat(props.byteSize);
+        props.labelName = name;
+        props.labelByteSize = props.byteSize;
+    }
+    return props.label;
+}
+
+static const std::string& GetProgressLabel(const std::string& id, ComponentProps& props, const ComponentState& state)
+{
+    const char* name = GetComponentLocaleName(id);
+    const TreeRemover::Counts& removed = state.uninstallState.removed;
+    if (name != props.progressLabelName || !(removed == props.progressLabelCounts)) {
+        char buffer[512];
+        snprintf(buffer, sizeof(buffer), Locale::Get(LocaleKey::uninstallProgress), name, BytesToReadableFormat(static_cast<float>(removed.bytes)).c_str(),
+                 BytesToReadableFormat(props.byteSize).c_str(), std::to_string(removed.files).c_str(), std::to_string(state.uninstallState.totalFiles).c_str());
+        props.progressLabel = buffer;
+        props.progressLabelName = name;
+        props.progressLabelCounts = removed;
+    }
+    return props.progressLabel;
+}
+
 // clang-format off
 void InitializeUninstaller()
 {
@@ -126,6 +206,7 @@ void InitializeUninstaller()
 
     isUninstalling = false;
     uninstallFinished = false;
+    isSizeScanPending = true;
 
     bool isNewLayout = std::filesystem::exists(millenniumPath);
 
@@ -171,53 +252,105 @@ void InitializeUninstaller()
 }
 // clang-format on
 
+/** Apply one component's result on the renderer thread; the worker never writes uninstallComponents itself */
+static void PostComponentState(size_t index, ComponentState::UninstallState::State state, std::optional<std::string> errorMessage = std::nullopt)
+{
+    UiEvents::Post([index, state, errorMessage = std::move(errorMessage)]
+    {
+        auto& uninstallState = std::get<0>(uninstallComponents[index].second).uninstallState;
+        uninstallState.state = state;
+        if (errorMessage) {
+            uninstallState.errorMessage = errorMessage;
+        }
+    });
+}
+
+/** Report a component's outcome, listing the first few paths that couldn't be removed */
+static void PostComponentResult(size_t index, const std::vector<TreeRemover::Failure>& failures)
+{
+    constexpr size_t MaxListedFailures = 3;
+
+    if (failures.empty()) {
+        PostComponentState(index, ComponentState::UninstallState::Success);
+        return;
+    }
+
+    std::string message;
+    for (size_t i = 0; i < failures.size(); i++) {
+        std::cout << "[uninstall] Failed to remove " << failures[i].path.string() << ": " << failures[i].message << std::endl;
+        if (i < MaxListedFailures) {
+            message += (i ? "\n" : "") + failures[i].path.string() + ": " + failures[i].message;
+        }
+    }
+    if (failures.size() > MaxListedFailures) {
+        char buffer[128];
+        snprintf(buffer, sizeof(buffer), Locale::Get(LocaleKey::uninstallMoreFailures), std::to_string(failures.size() - MaxListedFailures).c_str());
+        message += "\n" + std::string(buffer);
+    }
+
+    PostComponentState(index, ComponentState::UninstallState::Failed, std::move(message));
+}
+
+/**
+ * Worker thread. Selection and path lists are only read here; they can't change while isUninstalling holds the
+ * checkboxes, and every state change is handed back to the renderer through UiEvents.
+ */
 void StartUninstall()
 {
     /** Kill Steam before uninstalling */
     KillSteamProcess();
 
-    /** Render all selected components as uninstalling */
-    std::for_each(uninstallComponents.begin(), uninstallComponents.end(), [](auto& pair)
+    /** One removal group per selected component, all rendered as uninstalling */
+    std::vector<size_t> selected;
+    std::vector<std::vector<std::filesystem::path>> groups;
+    for (size_t i = 0; i < uninstallComponents.size(); i++) {
+        const auto& [state, props] = uninstallComponents[i].second;
+        if (state.isSelected) {
+            selected.push_back(i);
+            groups.emplace_back(props.pathList.begin(), props.pathList.end());
+            PostComponentState(i, ComponentState::UninstallState::Uninstalling);
+        }
+    }
+
+    TreeRemover remover(groups);
+
+    /** The walk's totals replace whatever the size scan had reached */
+    UiEvents::Post([selected, totals = remover.totals()]
     {
-        if (std::get<0>(pair.second).isSelected)
-            std::get<0>(pair.second).uninstallState.state = ComponentState::UninstallState::Uninstalling;
+        for (size_t i = 0; i < selected.size(); i++) {
+            auto& [state, props] = uninstallComponents[selected[i]].second;
+            props.byteSize = static_cast<float>(totals[i].bytes);
+            state.uninstallState.totalFiles = totals[i].files;
+        }
     });
 
-    /** Simulate uninstalling process */
-    for (auto& componentPair : uninstallComponents) {
-        auto& [state, props] = componentPair.second;
-        if (state.isSelected) {
-            std::this_thread::sleep_for(std::chrono::milliseconds(300));
-
-            /** If the path list is empty, the component is already uninstalled */
-            if (props.pathList.empty()) {
-                state.uninstallState.state = ComponentState::UninstallState::Success;
-                continue;
+    std::vector<TreeRemover::GroupResult> results = remover.run([&selected](const std::vector<TreeRemover::Counts>& removed)
+    {
+        UiEvents::Post([selected, removed]
+        {
+            for (size_t i = 0; i < selected.size(); i++) {
+                std::get<0>(uninstallComponents[selected[i]].second).uninstallState.removed = removed[i];
             }
+        });
+    });
 
-            for (const auto& path : props.pathList) {
-                std::error_code ec;
-                std::filesystem::remove_all(path, ec); // Remove the path
-                if (ec) {
-                    state.uninstallState.state = ComponentState::UninstallState::Failed;
-                    state.uninstallState.errorMessage = ec.message();
-                } else {
-                    state.uninstallState.state = ComponentState::UninstallState::Success;
-                }
-            }
-        }
+    for (size_t i = 0; i < selected.size(); i++) {
+        PostComponentResult(selected[i], results[i].failures);
     }
 
-    uninstallFinished = true;
+    UiEvents::Post([] { uninstallFinished = true; });
 }
 
 std::string GetReclaimedSpace()
 {
     uint64_t totalSize = 0;
 
+    /** Sizes found so far until the uninstall starts, then what has actually been freed */
     for (auto& componentPair : uninstallComponents) {
         const auto& [state, props] = componentPair.second;
-        totalSize += state.isSelected ? props.byteSize : 0;
+        if (state.isSelected) {
+            totalSize += isUninstalling ? state.uninstallState.removed.bytes : static_cast<uint64_t>(props.byteSize);
+        }
     }
 
     return BytesToReadableFormat(totalSize);
@@ -231,26 +364,20 @@ const void RenderComponents()
 
         SetCursorPosY(GetCursorPosY() + ScaleY(5));
 
-        std::string strPathList;
-
-        for (const auto& path : props.pathList) {
-            strPathList += path + "\n";
-        }
-
-        std::string formattedComponent = std::string(GetComponentLocaleName(component)) + ": " + BytesToReadableFormat(props.byteSize);
+        const std::string& formattedComponent = GetComponentLabel(component, props);
 
         BeginChild(component.c_str(), { ScaleX(35), ScaleY(35) }, false, ImGuiWindowFlags_NoScrollbar | ImGuiWindowFlags_NoScrollWithMouse);
         {
             /** Not currently uninstalling, the user is selecting components to be uninstalled */
             if (!isUninstalling) {
-                state.isSelected = RenderCheckBox(state.isSelected, formattedComponent, strPathList, false, true)->isChecked;
+                state.isSelected = RenderCheckBox(state.isSelected, formattedComponent, props.pathListText, false, true)->isChecked;
                 continue;
             }
 
             /** Item is excluded from the uninstaller */
             if (!state.isSelected) {
                 SetCursorPos({ GetCursorPosX() + ScaleX(2), GetCursorPosY() + ScaleY(2) });
-                Image((ImTextureID)(intptr_t)excludedIconTexture, { ScaleX(30), ScaleY(30) });
+                DrawIcon(Icon::Excluded, { ScaleX(30), ScaleY(30) });
                 EndChild();
 
                 if (IsItemHovered()) {
@@ -259,7 +386,7 @@ const void RenderComponents()
                     PushStyleVar(ImGuiStyleVar_WindowRounding, 6);
                     PushStyleVar(ImGuiStyleVar_Alpha, 1.f);
                     PushStyleColor(ImGuiCol_PopupBg, ImVec4(0.098f, 0.102f, 0.11f, 1.0f));
-                    SetTooltip(Locale::Get("uninstallExcluded"), GetComponentLocaleName(component));
+                    SetTooltip(Locale::Get(LocaleKey::uninstallExcluded), GetComponentLocaleName(component));
                     PopStyleVar(3);
                     PopStyleColor();
                 }
@@ -277,18 +404,18 @@ const void RenderComponents()
                 case ComponentState::UninstallState::Uninstalling:
                 {
                     SetCursorPos({ GetCursorPosX() + spinnerSize / 2, (GetCursorPosY() + spinnerSize / 2) - 5.f });
-                    Spinner<SpinnerTypeT::e_st_ang>("SpinnerAngNoBg", Radius{ (spinnerSize) }, Thickness{ (ScaleX(3)) }, Color{ ImColor(255, 255, 255, 255) },
-                                                    BgColor{ ImColor(255, 255, 255, 0) }, Speed{ 6 }, Angle{ IM_PI }, Mode{ 0 });
+                    FrameScheduler::RequestFrame();
+                    RenderSpinner("SpinnerAngNoBg", spinnerSize, ScaleX(3), ImVec4(1.f, 1.f, 1.f, 1.f));
                     EndChild();
                     SameLine(0, ScaleX(20));
                     SetCursorPosY(GetCursorPosY() + ScaleY(3));
-                    Text("%s", formattedComponent.c_str());
+                    Text("%s", GetProgressLabel(component, props, state).c_str());
                     break;
                 }
                 case ComponentState::UninstallState::Success:
                 {
                     SetCursorPos({ GetCursorPosX() + ScaleX(2), GetCursorPosY() + ScaleY(2) });
-                    Image((ImTextureID)(intptr_t)successIconTexture, { ScaleX(30), ScaleY(30) });
+                    DrawIcon(Icon::Success, { ScaleX(30), ScaleY(30) });
                     EndChild();
 
                     SameLine(0, ScaleX(20));
@@ -300,7 +427,7 @@ const void RenderComponents()
                 case ComponentState::UninstallState::Failed:
                 {
                     SetCursorPos({ GetCursorPosX() + ScaleX(2), GetCursorPosY() + ScaleY(2) });
-                    Image((ImTextureID)(intptr_t)errorIconTexture, ImVec2(ScaleX(30), ScaleY(30)));
+                    DrawIcon(Icon::Error, ImVec2(ScaleX(30), ScaleY(30)));
                     EndChild();
 
                     if (IsItemHovered()) {
@@ -309,14 +436,14 @@ const void RenderComponents()
                         PushStyleVar(ImGuiStyleVar_WindowRounding, 6);
                         PushStyleVar(ImGuiStyleVar_Alpha, 1.f);
                         PushStyleColor(ImGuiCol_PopupBg, ImVec4(0.098f, 0.102f, 0.11f, 1.0f));
-                        SetTooltip(Locale::Get("uninstallFailed"), GetComponentLocaleName(component), state.uninstallState.errorMessage.value_or("Unknown error").c_str());
+                        SetTooltip(Locale::Get(LocaleKey::uninstallFailed), GetComponentLocaleName(component), state.uninstallState.errorMessage.value_or("Unknown error").c_str());
                         PopStyleVar(3);
                         PopStyleColor();
                     }
 
                     SameLine(0, ScaleX(20));
                     SetCursorPosY(GetCursorPosY() + ScaleY(3));
-                    Text("%s", formattedComponent.c_str());
+                    Text("%s", GetProgressLabel(component, props, state).c_str());
 
                     break;
                 }
@@ -349,18 +476,23 @@ const void RenderUninstallSelect(std::shared_ptr<RouterNav> router, float xPos)
 
     static auto animationStartTime = std::chrono::steady_clock::now();
 
+    if (isSizeScanPending) {
+        isSizeScanPending = false;
+        StartSizeScan();
+    }
+
     SetCursorPos({ xPos + (viewport->Size.x - PromptContainerWidth) / 2, (viewport->Size.y - PromptContainerHeight) / 2 });
     PushStyleColor(ImGuiCol_Border, ImVec4(0.169f, 0.173f, 0.18f, 1.0f));
 
     BeginChild("##PromptContainer", ImVec2(PromptContainerWidth, PromptContainerHeight), false);
     {
         PushFont(io.Fonts->Fonts[1]);
-        Text("%s", Locale::Get("uninstallTitle"));
+        Text("%s", Locale::Get(LocaleKey::uninstallTitle));
         PopFont();
 
         SetCursorPosY(GetCursorPosY() + ScaleY(5));
         PushStyleColor(ImGuiCol_Text, ImVec4(0.422f, 0.425f, 0.441f, 1.0f));
-        TextWrapped("%s", Locale::Get("uninstallSubtitle"));
+        TextLayout::TextWrapped(Locale::Get(LocaleKey::uninstallSubtitle));
 
         SetCursorPosY(GetCursorPosY() + ScaleY(30));
         RenderComponents();
@@ -369,8 +501,8 @@ const void RenderUninstallSelect(std::shared_ptr<RouterNav> router, float xPos)
         Separator();
         SetCursorPosY(GetCursorPosY() + ScaleY(5));
 
-        Text(Locale::Get("uninstallFrom"), steamPath.string().c_str());
-        Text(Locale::Get("uninstallSpace"), GetReclaimedSpace().c_str());
+        Text(Locale::Get(LocaleKey::uninstallFrom), steamPath.string().c_str());
+        Text(Locale::Get(LocaleKey::uninstallSpace), GetReclaimedSpace().c_str());
 
         PopStyleColor();
     }
@@ -388,7 +520,7 @@ const void RenderUninstallSelect(std::shared_ptr<RouterNav> router, float xPos)
             PushStyleColor(ImGuiCol_ButtonHovered, ImVec4(currentColor, currentColor, currentColor, 1.0f));
             PushStyleColor(ImGuiCol_ButtonActive, ImVec4(0.8f, 0.8f, 0.8f, 1.0f));
 
-            if (Button(Locale::Get("uninstallExit"), ImVec2(xPos + GetContentRegionAvail().x, GetContentRegionAvail().y))) {
+            if (Button(Locale::Get(LocaleKey::uninstallExit), ImVec2(xPos + GetContentRegionAvail().x, GetContentRegionAvail().y))) {
                 std::exit(0);
             }
 
@@ -410,8 +542,8 @@ const void RenderUninstallSelect(std::shared_ptr<RouterNav> router, float xPos)
                 const float spinnerSize = ScaleX(12.f);
                 SetCursorPos({ childWidth / 2 - spinnerSize, spinnerSize });
 
-                Spinner<SpinnerTypeT::e_st_ang>("SpinnerAngNoBg", Radius{ spinnerSize }, Thickness{ ScaleX(2) }, Color{ ImColor(0, 0, 0, 255) },
-                                                BgColor{ ImColor(255, 255, 255, 0) }, Speed{ 6 }, Angle{ IM_PI }, Mode{ 0 });
+                FrameScheduler::RequestFrame();
+                RenderSpinner("SpinnerAngNoBg", spinnerSize, ScaleX(2), ImVec4(0.f, 0.f, 0.f, 1.f));
             }
             EndChild();
             PopStyleColor();
@@ -427,10 +559,12 @@ const void RenderUninstallSelect(std::shared_ptr<RouterNav> router, float xPos)
             PushStyleColor(ImGuiCol_ButtonHovered, ImVec4(currentColor, currentColor, currentColor, 1.0f));
             PushStyleColor(ImGuiCol_ButtonActive, ImVec4(0.8f, 0.8f, 0.8f, 1.0f));
 
-            if (Button(Locale::Get("uninstallButton"), ImVec2(xPos + GetContentRegionAvail().x, GetContentRegionAvail().y))) {
+            if (Button(Locale::Get(LocaleKey::uninstallButton), ImVec2(xPos + GetContentRegionAvail().x, GetContentRegionAvail().y))) {
                 std::cout << "Uninstalling components..." << std::endl;
 
                 isUninstalling = true;
+                /** The trees are about to be deleted; keep the sizes found so far */
+                CancelUninstallerScan();
                 GetWorker().run(StartUninstall);
             }
 
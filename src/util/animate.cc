@@ -29,10 +29,9 @@
  */
 
 #include <animate.h>
-#include <unordered_map>
+#include <vector>
 #include <imgui.h>
 #include <dpi.h>
-#include <mutex>
 
 /** Based on https://stackoverflow.com/questions/13462001/ease-in-and-ease-out-animation-formula */
 float EaseInOut(float t)
@@ -49,37 +48,133 @@ struct FloatAnimationState
     bool isReversing = false;
 
     float elapsedTime = 0.0f;
+    float duration = 0.0f;
     float currentValue = 0.0f;
     float minValue = 0.0f;
     float maxValue = 1.0f;
+};
+
+struct SmoothFloatState
+{
+    bool wasHovered = false;
+    bool isAnimating = false;
+
+    float elapsedTime = 0.0f;
+    float duration = 0.0f;
+    float easedProgress = 0.0f;
+
+    float currentPosY = 0.0f;
+    float startPosY = 0.0f;
+    float targetPosY = 0.0f;
 
     float lastXDPI = XDPI, lastYDPI = YDPI;
+};
 
-    FloatAnimationState() = default;
-    FloatAnimationState(float lower, float upper)
-        : wasHovered(false), isAnimating(false), isReversing(false), elapsedTime(0.0f), currentValue(lower), minValue(lower), maxValue(upper)
+/**
+ * Open-addressing hash table from ImGuiID to animation state, probed linearly over one contiguous array.
+ * Entries are never removed: the UI has a small, fixed set of animated widgets, and each keeps its state for the
+ * lifetime of the window exactly like the maps this replaced.
+ */
+template <typename State> class AnimationTable
+{
+  public:
+    /** Returns the state for `id`, default constructing it if this is its first use. */
+    State& Get(ImGuiID id, bool& inserted)
     {
+        /** 0 marks an empty slot */
+        id = id ? id : 1;
+
+        if ((m_count + 1) * 4 > m_slots.size() * 3) {
+            Grow();
+        }
+
+        size_t index = Probe(m_slots, id);
+        inserted = m_slots[index].id == 0;
+
+        if (inserted) {
+            m_slots[index].id = id;
+            m_count++;
+        }
+        return m_slots[index].state;
+    }
+
+    /** Step every animation in motion; returns how many are still moving afterwards. */
+    template <typename Step> size_t AdvanceAll(Step&& step)
+    {
+        size_t animating = 0;
+
+        for (Slot& slot : m_slots) {
+            if (slot.id != 0 && slot.state.isAnimating) {
+                step(slot.state);
+                animating += slot.state.isAnimating ? 1 : 0;
+            }
+        }
+        return animating;
+    }
+
+  private:
+    struct Slot
+    {
+        ImGuiID id = 0;
+        State state;
+    };
+
+    std::vector<Slot> m_slots = std::vector<Slot>(64);
+    size_t m_count = 0;
+
+    static size_t Probe(const std::vector<Slot>& slots, ImGuiID id)
+    {
+        const size_t mask = slots.size() - 1;
+        size_t index = id & mask;
+
+        while (slots[index].id != 0 && slots[index].id != id) {
+            index = (index + 1) & mask;
+        }
+        return index;
+    }
+
+    void Grow()
+    {
+        std::vector<Slot> grown(m_slots.size() * 2);
+
+        for (Slot& slot : m_slots) {
+            if (slot.id != 0) {
+                grown[Probe(grown, slot.id)] = std::move(slot);
+            }
+        }
+        m_slots = std::move(grown);
     }
 };
 
-std::unordered_map<std::string, FloatAnimationState> g_floatAnimations;
-std::mutex g_floatAnimationsMutex;
-} // namespace
+AnimationTable<FloatAnimationState> g_floatAnimations;
+AnimationTable<SmoothFloatState> g_smoothFloats;
+
+/** Animations still in motion after the last AdvanceAnimations() */
+size_t g_activeAnimations = 0;
 
-float EaseInOutFloat(const std::string& id, float lowerBound, float upperBound, bool currentState, float duration)
+float ProgressOf(float elapsedTime, float duration, bool& isAnimating)
 {
-    std::lock_guard<std::mutex> lock(g_floatAnimationsMutex);
+    float progress = duration > 0.0f ? elapsedTime / duration : 1.0f;
 
-    auto it = g_floatAnimations.find(id);
-    if (it == g_floatAnimations.end()) {
-        g_floatAnimations[id] = FloatAnimationState(lowerBound, upperBound);
-        g_floatAnimations[id].currentValue = currentState ? upperBound : lowerBound;
-        g_floatAnimations[id].wasHovered = currentState;
+    if (progress >= 1.0f) {
+        progress = 1.0f;
+        isAnimating = false;
     }
+    return progress;
+}
+} // namespace
 
-    FloatAnimationState& state = g_floatAnimations[id];
+float EaseInOutFloat(ImGuiID id, float lowerBound, float upperBound, bool currentState, float duration)
+{
+    bool inserted;
+    FloatAnimationState& state = g_floatAnimations.Get(id, inserted);
 
-    float deltaTime = ImGui::GetIO().DeltaTime;
+    if (inserted) {
+        state.minValue = lowerBound;
+        state.maxValue = upperBound;
+        state.currentValue = currentState ? upperBound : lowerBound;
+        state.wasHovered = currentState;
+    }
 
     if (currentState != state.wasHovered) {
         state.wasHovered = currentState;
@@ -88,26 +183,15 @@ float EaseInOutFloat(const std::string& id, float lowerBound, float upperBound,
         state.elapsedTime = 0.0f;
     }
 
-    if (state.isAnimating) {
-        state.elapsedTime += deltaTime;
-        float progress = state.elapsedTime / duration;
-
-        if (progress >= 1.0f) {
-            progress = 1.0f;
-            state.isAnimating = false;
-        }
-
-        float easedProgress = EaseInOut(progress);
-
-        float startValue = state.currentValue;
-        float targetValue = state.isReversing ? state.minValue : state.maxValue;
-
-        state.currentValue = startValue + (targetValue - startValue) * easedProgress;
-    }
-
+    state.duration = duration;
     return state.currentValue;
 }
 
+float EaseInOutFloat(const char* id, float lowerBound, float upperBound, bool currentState, float duration)
+{
+    return EaseInOutFloat(ImGui::GetID(id), lowerBound, upperBound, currentState, duration);
+}
+
 /**
  * Smoothly float an element to a target offset.
  * @param id The unique identifier for the animation.
@@ -118,15 +202,12 @@ float EaseInOutFloat(const std::string& id, float lowerBound, float upperBound,
  *
  *
  */
-float SmoothFloat(const std::string& id, float targetOffset, bool currentState, float displacement, float duration, std::tuple<float, float> colorTransition)
+float SmoothFloat(ImGuiID id, float targetOffset, bool currentState, float displacement, float duration, std::tuple<float, float> colorTransition)
 {
-    static std::unordered_map<std::string, AnimationState> animations;
-    static std::mutex animationsMutex;
-
-    std::lock_guard<std::mutex> lock(animationsMutex);
-
     const auto [lowerBound, upperBound] = colorTransition;
-    AnimationState& state = animations[id];
+
+    bool inserted;
+    SmoothFloatState& state = g_smoothFloats.Get(id, inserted);
 
     float currentXDPI = XDPI;
     float currentYDPI = YDPI;
@@ -140,34 +221,55 @@ float SmoothFloat(const std::string& id, float targetOffset, bool currentState,
     if (state.currentPosY == 0.0f)
         state.currentPosY = ImGui::GetCursorPosY();
 
-    float deltaTime = ImGui::GetIO().DeltaTime;
-
     if (currentState != state.wasHovered) {
         state.wasHovered = currentState;
         state.isAnimating = true;
         state.elapsedTime = 0.0f;
+        state.easedProgress = 0.0f;
         state.startPosY = state.currentPosY;
     }
 
-    float targetPosY = currentState ? targetOffset - displacement : targetOffset;
-    float result = upperBound;
+    state.duration = duration;
+    state.targetPosY = currentState ? targetOffset - displacement : targetOffset;
 
-    if (state.isAnimating) {
+    ImGui::SetCursorPosY(state.currentPosY);
+    return state.isAnimating ? lowerBound + (upperBound - lowerBound) * state.easedProgress : upperBound;
+}
+
+float SmoothFloat(const char* id, float targetOffset, bool currentState, float displacement, float duration, std::tuple<float, float> colorTransition)
+{
+    return SmoothFloat(ImGui::GetID(id), targetOffset, currentState, displacement, duration, colorTransition);
+}
+
+/**
+ * Tweens only record their target while the UI is built; the values move here, in one pass over both tables after the
+ * frame's widgets have been submitted. The renderer keeps drawing for as long as this returns true.
+ */
+bool AdvanceAnimations(float deltaTime)
+{
+    const size_t floatsAnimating = g_floatAnimations.AdvanceAll([deltaTime](FloatAnimationState& state) {
         state.elapsedTime += deltaTime;
 
-        float progress = state.elapsedTime / duration;
-        if (progress >= 1.0f) {
-            progress = 1.0f;
-            state.isAnimating = false;
-        }
+        float easedProgress = EaseInOut(ProgressOf(state.elapsedTime, state.duration, state.isAnimating));
+        float targetValue = state.isReversing ? state.minValue : state.maxValue;
 
-        float easedProgress = EaseInOut(progress);
-        result = lowerBound + (upperBound - lowerBound) * easedProgress;
-        state.currentPosY = state.startPosY + (easedProgress * (targetPosY - state.startPosY));
-    }
+        state.currentValue = state.currentValue + (targetValue - state.currentValue) * easedProgress;
+    });
 
-    ImGui::SetCursorPosY(state.currentPosY);
-    return result;
+    const size_t smoothFloatsAnimating = g_smoothFloats.AdvanceAll([deltaTime](SmoothFloatState& state) {
+        state.elapsedTime += deltaTime;
+
+        state.easedProgress = EaseInOut(ProgressOf(state.elapsedTime, state.duration, state.isAnimating));
+        state.currentPosY = state.startPosY + (state.easedProgress * (state.targetPosY - state.startPosY));
+    });
+
+    g_activeAnimations = floatsAnimating + smoothFloatsAnimating;
+    return g_activeAnimations != 0;
+}
+
+size_t ActiveAnimationCount()
+{
+    return g_activeAnimations;
 }
 
 float EaseInOutTime(float t, float b, float c, float d)
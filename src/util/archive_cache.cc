@@ -0,0 +1,190 @@
+/**
+ * ==================================================
+ *   _____ _ _ _             _
+ *  |     |_| | |___ ___ ___|_|_ _ _____
+ *  | | | | | | | -_|   |   | | | |     |
+ *  |_|_|_|_|_|_|___|_|_|_|_|_|___|_|_|_|
+ *
+ * ==================================================
+ *
+ * Copyright (c) 2025 Project Millennium
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <archive_cache.h>
+#include <trace.h>
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+namespace
+{
+/** Digests become file names, so only accept exactly what a sha256 hex string can contain. */
+bool IsValidDigest(const std::string& sha256Hex)
+{
+    return sha256Hex.size() == 64 && std::all_of(sha256Hex.begin(), sha256Hex.end(), [](char c) { return (c >= '0' && c <= '9') || (c >= 'a' && c <= 'f'); });
+}
+
+fs::path EntryPath(const std::string& sha256Hex)
+{
+    return ArchiveCache::GetDirectory() / sha256Hex;
+}
+} // namespace
+
+fs::path ArchiveCache::GetDirectory()
+{
+#ifdef _WIN32
+    if (const char* localAppData = std::getenv("LOCALAPPDATA"); localAppData && *localAppData) {
+        return fs::path(localAppData) / "MillenniumInstaller" / "cache";
+    }
+#else
+    if (const char* xdgCache = std::getenv("XDG_CACHE_HOME"); xdgCache && *xdgCache) {
+        return fs::path(xdgCache) / "millennium-installer";
+    }
+    if (const char* home = std::getenv("HOME"); home && *home) {
+        return fs::path(home) / ".cache" / "millennium-installer";
+    }
+#endif
+    return fs::temp_directory_path() / "MillenniumInstallerCache";
+}
+
+std::optional<fs::path> ArchiveCache::Lookup(const std::string& sha256Hex)
+{
+    TRACE_SCOPE("ArchiveCache::Lookup", "cache", sha256Hex);
+
+    if (!IsValidDigest(sha256Hex)) {
+        return std::nullopt;
+    }
+
+    std::error_code ec;
+    const fs::path entry = EntryPath(sha256Hex);
+
+    if (!fs::is_regular_file(entry, ec)) {
+        std::cout << "[cache] miss " << sha256Hex << std::endl;
+        return std::nullopt;
+    }
+
+    /** The modification time doubles as the LRU timestamp */
+    fs::last_write_time(entry, fs::file_time_type::clock::now(), ec);
+
+    std::cout << "[cache] hit " << entry.string() << std::endl;
+    return entry;
+}
+
+std::optional<fs::path> ArchiveCache::Store(const fs::path& file, const std::string& sha256Hex)
+{
+    TRACE_SCOPE("ArchiveCache::Store", "cache", sha256Hex);
+
+    if (!IsValidDigest(sha256Hex)) {
+        return std::nullopt;
+    }
+
+    std::error_code ec;
+    const fs::path directory = GetDirectory();
+    fs::create_directories(directory, ec);
+    if (ec) {
+        std::cerr << "[cache] Failed to create " << directory.string() << ": " << ec.message() << std::endl;
+        return std::nullopt;
+    }
+
+    const fs::path entry = EntryPath(sha256Hex);
+
+    /** A rename is atomic when the download landed on the same volume; otherwise copy to a side file and rename that into place */
+    fs::rename(file, entry, ec);
+    if (ec) {
+        const fs::path partial = entry.string() + ".partial";
+        ec.clear();
+        fs::copy_file(file, partial, fs::copy_options::overwrite_existing, ec);
+        if (!ec) {
+            fs::rename(partial, entry, ec);
+        }
+        if (ec) {
+            std::cerr << "[cache] Failed to store " << file.string() << ": " << ec.message() << std::endl;
+            fs::remove(partial, ec);
+            return std::nullopt;
+        }
+        fs::remove(file, ec);
+    }
+
+    fs::last_write_time(entry, fs::file_time_type::clock::now(), ec);
+    std::cout << "[cache] stored " << entry.string() << std::endl;
+
+    Evict();
+    return entry;
+}
+
+void ArchiveCache::Remove(const std::string& sha256Hex)
+{
+    if (!IsValidDigest(sha256Hex)) {
+        return;
+    }
+
+    std::error_code ec;
+    fs::remove(EntryPath(sha256Hex), ec);
+}
+
+void ArchiveCache::Evict(uintmax_t maxBytes)
+{
+    TRACE_SCOPE("ArchiveCache::Evict", "cache");
+
+    struct Entry
+    {
+        fs::path path;
+        uintmax_t size;
+        fs::file_time_type lastUsed;
+    };
+
+    std::error_code ec;
+    std::vector<Entry> entries;
+    uintmax_t totalBytes = 0;
+
+    for (const auto& item : fs::directory_iterator(GetDirectory(), ec)) {
+        if (!item.is_regular_file(ec)) {
+            continue;
+        }
+
+        const uintmax_t size = item.file_size(ec);
+        const auto lastUsed = item.last_write_time(ec);
+        if (ec) {
+            ec.clear();
+            continue;
+        }
+
+        entries.push_back({ item.path(), size, lastUsed });
+        totalBytes += size;
+    }
+
+    if (totalBytes <= maxBytes) {
+        return;
+    }
+
+    /** The most recently used entry is never evicted, even if it alone is over the cap, since it's about to be installed */
+    std::sort(entries.begin(), entries.end(), [](const Entry& a, const Entry& b) { return a.lastUsed < b.lastUsed; });
+
+    for (size_t i = 0; i + 1 < entries.size() && totalBytes > maxBytes; i++) {
+        if (fs::remove(entries[i].path, ec)) {
+            std::cout << "[cache] evicted " << entries[i].path.string() << std::endl;
+            totalBytes -= entries[i].size;
+        }
+    }
+}
@@ -0,0 +1,82 @@
+/**
+ * ==================================================
+ *   _____ _ _ _             _
+ *  |     |_| | |___ ___ ___|_|_ _ _____
+ *  | | | | | | | -_|   |   | | | |     |
+ *  |_|_|_|_|_|_|___|_|_|_|_|_|___|_|_|_|
+ *
+ * ==================================================
+ *
+ * Copyright (c) 2025 Project Millennium
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <assets.h>
+#include <trace.h>
+#include <zlib.h>
+#include <iostream>
+#include <memory>
+#include <mutex>
+
+namespace
+{
+struct InflatedAsset
+{
+    std::once_flag once;
+    std::unique_ptr<unsigned char[]> bytes;
+};
+
+InflatedAsset s_inflated[(size_t)Assets::Id::Count];
+} // namespace
+
+std::span<const unsigned char> Assets::Get(Id id)
+{
+    const Embedded& asset = EMBEDDED[(size_t)id];
+    if (!asset.compressed) {
+        return { asset.data, asset.size };
+    }
+
+    InflatedAsset& inflated = s_inflated[(size_t)id];
+    std::call_once(inflated.once, [&]()
+    {
+        TRACE_SCOPE("Assets::Inflate", "assets");
+
+        auto bytes = std::make_unique<unsigned char[]>(asset.size);
+        uLongf length = (uLongf)asset.size;
+        const int result = uncompress(bytes.get(), &length, asset.data, (uLong)asset.storedSize);
+
+        if (result != Z_OK || length != asset.size) {
+            std::cerr << "[assets] Failed to inflate embedded asset " << (size_t)id << " (zlib error " << result << ")" << std::endl;
+            return;
+        }
+        inflated.bytes = std::move(bytes);
+    });
+
+    if (!inflated.bytes) {
+        return {};
+    }
+    return { inflated.bytes.get(), asset.size };
+}
+
+Assets::Image Assets::GetImage(Id id)
+{
+    const Embedded& asset = EMBEDDED[(size_t)id];
+    return { Get(id).data(), asset.width, asset.height };
+}
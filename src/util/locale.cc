@@ -30,49 +30,19 @@
 
 #include <i18n.h>
 #include <locale_data.h>       // generated by CMake from src/locales/*.json
-#include <unordered_map>
+#include <algorithm>
 #include <string>
+#include <string_view>
 #include <vector>
-#include <nlohmann/json.hpp>
 
 #ifdef _WIN32
 #include <windows.h>
 #endif
 
-using TranslationMap = std::unordered_map<std::string, std::string>;
-
-// ─── Embedded locale table ────────────────────────────────────────────────────
-
-static const std::unordered_map<std::string, const char*> kEmbeddedLocales = {
-    { "english",    kLocaleData_english    },
-    { "russian",    kLocaleData_russian    },
-    { "ukrainian",  kLocaleData_ukrainian  },
-    { "german",     kLocaleData_german     },
-    { "french",     kLocaleData_french     },
-    { "spanish",    kLocaleData_spanish    },
-    { "italian",    kLocaleData_italian    },
-    { "polish",     kLocaleData_polish     },
-    { "turkish",    kLocaleData_turkish    },
-    { "swedish",    kLocaleData_swedish    },
-    { "dutch",      kLocaleData_dutch      },
-    { "brazilian",  kLocaleData_brazilian  },
-    { "hungarian",  kLocaleData_hungarian  },
-    { "indonesian", kLocaleData_indonesian },
-    { "vietnamese", kLocaleData_vietnamese },
-    { "schinese",   kLocaleData_schinese   },
-    { "tchinese",   kLocaleData_tchinese   },
-    { "japanese",   kLocaleData_japanese   },
-    { "koreana",    kLocaleData_koreana    },
-    { "latam",      kLocaleData_latam      },
-    { "bulgarian",  kLocaleData_bulgarian  },
-    { "danish",     kLocaleData_danish     },
-};
-
 // ─── Static state ─────────────────────────────────────────────────────────────
 
-static std::string    s_currentLang = "english";
-static TranslationMap s_currentTranslations;
-static TranslationMap s_englishTranslations;
+static std::string        s_currentLang    = "english";
+static const char* const* s_currentStrings = kLocaleStrings_english;
 
 static const std::vector<Locale::Language> s_languages = {
     // Latin-script languages (sorted alphabetically for the dropdown)
@@ -102,29 +72,41 @@ static const std::vector<Locale::Language> s_languages = {
     { "koreana",    "\xED\x95\x9C\xEA\xB5\xAD\xEC\x96\xB4"              },
 };
 
-// ─── JSON parsing ─────────────────────────────────────────────────────────────
+// ─── String tables ────────────────────────────────────────────────────────────
 
-static TranslationMap ParseLocale(const char* jsonStr)
+/** Unknown languages read the English table, matching a translation with no keys. */
+static const char* const* FindStrings(const std::string& langId)
 {
-    TranslationMap result;
-    if (!jsonStr || *jsonStr == '\0') return result;
+    for (const EmbeddedLocale& locale : kEmbeddedLocales) {
+        if (langId == locale.id) return locale.strings;
+    }
+    return kLocaleStrings_english;
+}
+
+/** Append the codepoints of a UTF-8 string; malformed sequences are skipped a byte at a time. */
+static void AppendCodepoints(std::string_view text, std::vector<char32_t>& out)
+{
+    for (size_t i = 0; i < text.size();) {
+        const unsigned char lead = static_cast<unsigned char>(text[i]);
+        const size_t length = lead < 0x80 ? 1 : (lead >> 5) == 0x6 ? 2 : (lead >> 4) == 0xE ? 3 : (lead >> 3) == 0x1E ? 4 : 0;
 
-    try {
-        nlohmann::json j = nlohmann::json::parse(jsonStr);
-        for (auto& [key, value] : j.items()) {
-            if (value.is_string())
-                result[key] = value.get<std::string>();
+        if (length == 0 || i + length > text.size()) {
+            i++;
+            continue;
         }
-    } catch (...) {}
 
-    return result;
-}
+        char32_t codepoint = length == 1 ? lead : lead & (0x7F >> length);
+        bool valid = true;
+        for (size_t j = 1; j < length; j++) {
+            const unsigned char next = static_cast<unsigned char>(text[i + j]);
+            valid = valid && (next & 0xC0) == 0x80;
+            codepoint = (codepoint << 6) | (next & 0x3F);
+        }
 
-static TranslationMap LoadLanguage(const std::string& langId)
-{
-    auto it = kEmbeddedLocales.find(langId);
-    if (it == kEmbeddedLocales.end()) return {};
-    return ParseLocale(it->second);
+        if (valid)
+            out.push_back(codepoint);
+        i += valid ? length : 1;
+    }
 }
 
 // ─── Platform language detection ──────────────────────────────────────────────
@@ -214,19 +196,14 @@ std::string Locale::DetectSystemLanguage()
 
 void Locale::Initialize()
 {
-    s_englishTranslations = LoadLanguage("english");
-    s_currentLang         = DetectSystemLanguage();
-    s_currentTranslations = (s_currentLang == "english")
-                          ? s_englishTranslations
-                          : LoadLanguage(s_currentLang);
+    s_currentLang    = DetectSystemLanguage();
+    s_currentStrings = FindStrings(s_currentLang);
 }
 
 void Locale::SetLanguage(const std::string& langId)
 {
-    s_currentLang         = langId;
-    s_currentTranslations = (langId == "english")
-                          ? s_englishTranslations
-                          : LoadLanguage(langId);
+    s_currentLang    = langId;
+    s_currentStrings = FindStrings(langId);
 }
 
 const std::string& Locale::GetCurrentLanguageId()
@@ -234,19 +211,9 @@ const std::string& Locale::GetCurrentLanguageId()
     return s_currentLang;
 }
 
-const char* Locale::Get(const std::string& key)
+const char* Locale::Get(LocaleKey key)
 {
-    {
-        auto it = s_currentTranslations.find(key);
-        if (it != s_currentTranslations.end())
-            return it->second.c_str();
-    }
-    {
-        auto it = s_englishTranslations.find(key);
-        if (it != s_englishTranslations.end())
-            return it->second.c_str();
-    }
-    return key.c_str();
+    return s_currentStrings[static_cast<size_t>(key)];
 }
 
 const std::vector<Locale::Language>& Locale::GetAvailableLanguages()
@@ -265,3 +232,19 @@ bool Locale::UsesCJK()
     return s_currentLang == "japanese"  || s_currentLang == "schinese"
         || s_currentLang == "tchinese"  || s_currentLang == "koreana";
 }
+
+std::vector<char32_t> Locale::GetCodepoints(const std::string& langId)
+{
+    const char* const* strings = FindStrings(langId);
+
+    std::vector<char32_t> codepoints;
+    for (size_t i = 0; i < static_cast<size_t>(LocaleKey::Count); i++)
+        AppendCodepoints(strings[i], codepoints);
+    if (strings != kLocaleStrings_english)
+        for (size_t i = 0; i < static_cast<size_t>(LocaleKey::Count); i++)
+            AppendCodepoints(kLocaleStrings_english[i], codepoints);
+
+    std::sort(codepoints.begin(), codepoints.end());
+    codepoints.erase(std::unique(codepoints.begin(), codepoints.end()), codepoints.end());
+    return codepoints;
+}
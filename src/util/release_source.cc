@@ -0,0 +1,281 @@
+/**
+ * ==================================================
+ *   _____ _ _ _             _
+ *  |     |_| | |___ ___ ___|_|_ _ _____
+ *  | | | | | | | -_|   |   | | | |     |
+ *  |_|_|_|_|_|_|___|_|_|_|_|_|___|_|_|_|
+ *
+ * ==================================================
+ *
+ * Copyright (c) 2025 Project Millennium
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <release_source.h>
+#include <trace.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <mutex>
+#include <sstream>
+
+namespace
+{
+const ReleaseSource::Source GITHUB_SOURCE = { "https://api.github.com", "https://github.com" };
+const std::string GITHUB_DOWNLOAD_PREFIX = "https://github.com/";
+
+/** Small enough to be served from any cache, and exercises the same endpoint the installer actually uses. */
+const std::string RACE_PROBE_PATH = "/repos/SteamClientHomebrew/Millennium/releases?per_page=1";
+
+std::mutex sourcesMutex;
+std::vector<ReleaseSource::Source> sources = { GITHUB_SOURCE };
+std::once_flag raceFlag;
+
+ReleaseSource::Source ParseSource(std::string url)
+{
+    if (url == "github") {
+        return GITHUB_SOURCE;
+    }
+
+    while (!url.empty() && url.back() == '/') {
+        url.pop_back();
+    }
+    return { url, url };
+}
+
+struct RaceEntry
+{
+    CURL* handle = nullptr;
+    size_t index = 0;
+    bool answered = false;
+    std::chrono::steady_clock::time_point firstByteTime;
+};
+
+/** Only the first byte matters, so note the time and abort the transfer. */
+size_t RaceWriteCallback(char*, size_t, size_t, void* userp)
+{
+    auto* entry = static_cast<RaceEntry*>(userp);
+
+    long statusCode = 0;
+    curl_easy_getinfo(entry->handle, CURLINFO_RESPONSE_CODE, &statusCode);
+
+    if (statusCode >= 200 && statusCode < 300) {
+        entry->answered = true;
+        entry->firstByteTime = std::chrono::steady_clock::now();
+    }
+    return 0;
+}
+} // namespace
+
+void ReleaseSource::Initialize(int argc, char** argv)
+{
+    std::vector<Source> configured;
+
+    if (const char* env = std::getenv("MILLENNIUM_RELEASE_SOURCES"); env && *env) {
+        std::stringstream stream(env);
+        std::string url;
+        while (std::getline(stream, url, ';')) {
+            if (!url.empty()) {
+                configured.push_back(ParseSource(url));
+            }
+        }
+    }
+
+    /** The command line takes precedence over the environment */
+    std::vector<Source> fromArgs;
+    for (int i = 1; i < argc; i++) {
+        const std::string arg = argv[i];
+        if (arg.rfind("--release-source=", 0) == 0 && arg.size() > 17) {
+            fromArgs.push_back(ParseSource(arg.substr(17)));
+        }
+    }
+    if (!fromArgs.empty()) {
+        configured = std::move(fromArgs);
+    }
+
+    if (configured.empty()) {
+        return;
+    }
+
+    for (const auto& source : configured) {
+        std::cout << "[release-source] " << source.apiBase << std::endl;
+    }
+
+    std::lock_guard<std::mutex> lock(sourcesMutex);
+    sources = std::move(configured);
+}
+
+std::vector<ReleaseSource::Source> ReleaseSource::GetSources()
+{
+    std::lock_guard<std::mutex> lock(sourcesMutex);
+    return sources;
+}
+
+void ReleaseSource::SelectFastest()
+{
+    const auto candidates = GetSources();
+    if (candidates.size() < 2) {
+        return;
+    }
+
+    TRACE_SCOPE("ReleaseSource::SelectFastest", "http");
+
+    CURLM* multi = curl_multi_init();
+    if (!multi) {
+        return;
+    }
+
+    const auto startTime = std::chrono::steady_clock::now();
+    std::vector<RaceEntry> entries(candidates.size());
+    std::vector<std::string> urls(candidates.size());
+
+    for (size_t i = 0; i < candidates.size(); i++) {
+        urls[i] = candidates[i].apiBase + RACE_PROBE_PATH;
+
+        RaceEntry& entry = entries[i];
+        entry.index = i;
+        entry.handle = curl_easy_init();
+        if (!entry.handle) {
+            continue;
+        }
+
+        curl_easy_setopt(entry.handle, CURLOPT_URL, urls[i].c_str());
+        curl_easy_setopt(entry.handle, CURLOPT_WRITEFUNCTION, RaceWriteCallback);
+        curl_easy_setopt(entry.handle, CURLOPT_WRITEDATA, &entry);
+        curl_easy_setopt(entry.handle, CURLOPT_USERAGENT, "starlight/1.0");
+        curl_easy_setopt(entry.handle, CURLOPT_FOLLOWLOCATION, 1L);
+        curl_easy_setopt(entry.handle, CURLOPT_CONNECTTIMEOUT, 5L);
+        curl_easy_setopt(entry.handle, CURLOPT_TIMEOUT, 10L);
+        curl_multi_add_handle(multi, entry.handle);
+    }
+
+    /** The first source to deliver a successful byte wins, the rest are abandoned mid-flight */
+    const RaceEntry* winner = nullptr;
+    int running = 1;
+
+    while (running > 0 && !winner) {
+        if (curl_multi_perform(multi, &running) != CURLM_OK) {
+            break;
+        }
+
+        for (const auto& entry : entries) {
+            if (entry.answered && (!winner || entry.firstByteTime < winner->firstByteTime)) {
+                winner = &entry;
+            }
+        }
+
+        if (!winner && running > 0) {
+            curl_multi_poll(multi, nullptr, 0, 100, nullptr);
+        }
+    }
+
+    for (auto& entry : entries) {
+        if (entry.handle) {
+            curl_multi_remove_handle(multi, entry.handle);
+            curl_easy_cleanup(entry.handle);
+        }
+    }
+    curl_multi_cleanup(multi);
+
+    if (!winner) {
+        std::cerr << "[release-source] no source answered the probe, keeping the configured order" << std::endl;
+        return;
+    }
+
+    const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(winner->firstByteTime - startTime).count();
+    std::cout << "[release-source] fastest source is " << candidates[winner->index].apiBase << " (" << elapsed << "ms to first byte)" << std::endl;
+
+    std::lock_guard<std::mutex> lock(sourcesMutex);
+    const auto fastest = std::find_if(sources.begin(), sources.end(), [&](const Source& source) { return source.apiBase == candidates[winner->index].apiBase; });
+    if (fastest != sources.end()) {
+        std::rotate(sources.begin(), fastest, fastest + 1);
+    }
+}
+
+Http::Response ReleaseSource::Get(const std::string& pathAndQuery)
+{
+    std::call_once(raceFlag, SelectFastest);
+
+    const auto candidates = GetSources();
+    Http::Response response;
+
+    for (size_t i = 0; i < candidates.size(); i++) {
+        const std::string url = candidates[i].apiBase + pathAndQuery;
+        response = Http::GetEx(url.c_str());
+
+        if (!response.isNetworkError() && !response.isRateLimited() && response.statusCode < 500) {
+            return response;
+        }
+
+        if (i + 1 < candidates.size()) {
+            std::cerr << "[release-source] " << candidates[i].apiBase << " failed, falling back to " << candidates[i + 1].apiBase << std::endl;
+        }
+    }
+    return response;
+}
+
+std::vector<std::string> ReleaseSource::GetDownloadUrls(const std::string& browserDownloadUrl)
+{
+    if (browserDownloadUrl.rfind(GITHUB_DOWNLOAD_PREFIX, 0) != 0) {
+        return { browserDownloadUrl };
+    }
+
+    const std::string assetPath = browserDownloadUrl.substr(GITHUB_DOWNLOAD_PREFIX.size() - 1);
+    std::vector<std::string> urls;
+
+    for (const auto& source : GetSources()) {
+        const std::string url = source.downloadBase + assetPath;
+        if (std::find(urls.begin(), urls.end(), url) == urls.end()) {
+            urls.push_back(url);
+        }
+    }
+    return urls;
+}
+
+std::string ReleaseSource::GetAsset(const std::string& browserDownloadUrl)
+{
+    for (const auto& url : GetDownloadUrls(browserDownloadUrl)) {
+        std::string body = Http::Get(url.c_str(), false);
+        if (!body.empty()) {
+            return body;
+        }
+    }
+    return {};
+}
+
+bool ReleaseSource::DownloadFile(const std::string& browserDownloadUrl, const std::string& outputPath, double fileSize, std::function<void(double, double)> progressCallback,
+                                 bool showProgress, bool showErrors)
+{
+    const auto urls = GetDownloadUrls(browserDownloadUrl);
+
+    for (size_t i = 0; i < urls.size(); i++) {
+        const bool isLastSource = i + 1 == urls.size();
+
+        if (Http::downloadFile(urls[i], outputPath, fileSize, progressCallback, showProgress, showErrors && isLastSource)) {
+            return true;
+        }
+
+        if (!isLastSource) {
+            std::cerr << "[release-source] download from " << urls[i] << " failed, trying " << urls[i + 1] << std::endl;
+        }
+    }
+    return false;
+}
@@ -0,0 +1,182 @@
+/**
+ * ==================================================
+ *   _____ _ _ _             _
+ *  |     |_| | |___ ___ ___|_|_ _ _____
+ *  | | | | | | | -_|   |   | | | |     |
+ *  |_|_|_|_|_|_|___|_|_|_|_|_|___|_|_|_|
+ *
+ * ==================================================
+ *
+ * Copyright (c) 2025 Project Millennium
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <size_scanner.h>
+#include <task_pool.h>
+#include <trace.h>
+
+namespace
+{
+/** How often running totals are reported while the scan is in progress */
+constexpr std::chrono::milliseconds kReportInterval{ 100 };
+
+/** Flush a directory's running total this often, so one huge flat directory still shows progress */
+constexpr size_t kFilesPerFlush = 512;
+
+/** Add up the files directly in `directory`, and queue a task for each of its subdirectories. */
+void ScanDirectory(TaskPool& pool, const std::filesystem::path& directory, std::atomic<uint64_t>& total, const std::atomic<bool>& cancelled)
+{
+    /** Cancelling joins the pool, so every task still queued must return before touching the disk */
+    if (cancelled.load(std::memory_order_relaxed)) {
+        return;
+    }
+
+    std::error_code ec;
+    std::filesystem::directory_iterator it(directory, std::filesystem::directory_options::skip_permission_denied, ec);
+    if (ec) {
+        return;
+    }
+
+    uint64_t bytes = 0;
+    size_t files = 0;
+
+    for (const std::filesystem::directory_iterator end; it != end; it.increment(ec)) {
+        if (ec || cancelled.load(std::memory_order_relaxed)) {
+            break;
+        }
+
+        const std::filesystem::directory_entry& entry = *it;
+        if (IsLinkEntry(entry, ec) || ec) {
+            ec.clear();
+            continue;
+        }
+
+        if (entry.is_directory(ec)) {
+            pool.submit([&pool, path = entry.path(), &total, &cancelled] { ScanDirectory(pool, path, total, cancelled); });
+        } else if (entry.is_regular_file(ec)) {
+            const uint64_t size = entry.file_size(ec);
+            if (!ec) {
+                bytes += size;
+            }
+            ec.clear();
+
+            if (++files % kFilesPerFlush == 0) {
+                total.fetch_add(bytes, std::memory_order_relaxed);
+                bytes = 0;
+            }
+        }
+    }
+
+    total.fetch_add(bytes, std::memory_order_relaxed);
+}
+
+void ScanRoot(TaskPool& pool, const std::filesystem::path& root, std::atomic<uint64_t>& total, const std::atomic<bool>& cancelled)
+{
+    if (cancelled.load(std::memory_order_relaxed)) {
+        return;
+    }
+
+    std::error_code ec;
+    const std::filesystem::directory_entry entry(root, ec);
+    if (ec || IsLinkEntry(entry, ec) || ec) {
+        return;
+    }
+
+    if (entry.is_regular_file(ec)) {
+        const uint64_t size = std::filesystem::file_size(root, ec);
+        if (!ec) {
+            total.fetch_add(size, std::memory_order_relaxed);
+        }
+    } else if (entry.is_directory(ec)) {
+        ScanDirectory(pool, root, total, cancelled);
+    }
+}
+} // namespace
+
+/** Symlinks and junctions can point back up the tree or outside it */
+bool IsLinkEntry(const std::filesystem::directory_entry& entry, std::error_code& ec)
+{
+#ifdef _WIN32
+    const std::filesystem::file_type type = entry.symlink_status(ec).type();
+    return type == std::filesystem::file_type::symlink || type == std::filesystem::file_type::junction;
+#else
+    /** Uses the type readdir() already returned, where symlink_status() would lstat() every entry */
+    return entry.is_symlink(ec);
+#endif
+}
+
+SizeScan::SizeScan(std::vector<std::vector<std::filesystem::path>> groups, Progress onProgress)
+    : m_onProgress(std::move(onProgress)), m_totals(std::make_unique<std::atomic<uint64_t>[]>(groups.size())), m_groupCount(groups.size())
+{
+    m_thread = std::thread(&SizeScan::run, this, std::move(groups));
+}
+
+SizeScan::~SizeScan()
+{
+    cancel();
+}
+
+void SizeScan::cancel()
+{
+    m_cancelled.store(true, std::memory_order_relaxed);
+    if (m_thread.joinable()) {
+        m_thread.join();
+    }
+}
+
+std::vector<uint64_t> SizeScan::snapshot() const
+{
+    std::vector<uint64_t> totals(m_groupCount);
+    for (size_t i = 0; i < m_groupCount; i++) {
+        totals[i] = m_totals[i].load(std::memory_order_relaxed);
+    }
+    return totals;
+}
+
+void SizeScan::run(std::vector<std::vector<std::filesystem::path>> groups)
+{
+    Trace::SetThreadName("size-scan");
+    TRACE_SCOPE("SizeScan", "uninstaller");
+
+    TaskPool pool;
+    for (size_t group = 0; group < groups.size(); group++) {
+        for (const std::filesystem::path& root : groups[group]) {
+            pool.submit([this, &pool, root, group] { ScanRoot(pool, root, m_totals[group], m_cancelled); });
+        }
+    }
+
+    std::vector<uint64_t> reported(m_groupCount, 0);
+    while (!pool.waitFor(kReportInterval)) {
+        if (m_cancelled.load(std::memory_order_relaxed)) {
+            /** The pool's destructor waits for the workers; queued directories return unopened, running ones stop at their next entry */
+            return;
+        }
+
+        std::vector<uint64_t> totals = snapshot();
+        if (totals != reported) {
+            m_onProgress(totals, false);
+            reported = std::move(totals);
+        }
+    }
+
+    if (!m_cancelled.load(std::memory_order_relaxed)) {
+        m_onProgress(snapshot(), true);
+    }
+}
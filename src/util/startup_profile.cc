@@ -0,0 +1,148 @@
+/**
+ * ==================================================
+ *   _____ _ _ _             _
+ *  |     |_| | |___ ___ ___|_|_ _ _____
+ *  | | | | | | | -_|   |   | | | |     |
+ *  |_|_|_|_|_|_|___|_|_|_|_|_|___|_|_|_|
+ *
+ * ==================================================
+ *
+ * Copyright (c) 2025 Project Millennium
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <startup_profile.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <format>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#include <vector>
+#include <nlohmann/json.hpp>
+
+namespace
+{
+struct PhaseRecord
+{
+    const char* name;
+    double start;    // milliseconds since process entry
+    double duration; // milliseconds
+    int depth;
+};
+
+/** Initialized with the other statics, before main runs; as close to process entry as portable code gets. */
+const auto s_processEntry = std::chrono::steady_clock::now();
+
+std::mutex s_mutex;
+std::vector<PhaseRecord> s_phases;
+std::string s_benchmarkPath;
+std::atomic<bool> s_firstFrameShown{ false };
+thread_local int t_depth = 0;
+
+double MillisecondsSinceEntry()
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - s_processEntry).count();
+}
+
+void WriteBenchmarkReport(double firstFrame, const std::vector<PhaseRecord>& phases)
+{
+    nlohmann::json report;
+    report["ttff_ms"] = firstFrame;
+    report["phases"] = nlohmann::json::array();
+
+    for (const PhaseRecord& phase : phases) {
+        report["phases"].push_back({
+            { "name",        phase.name     },
+            { "start_ms",    phase.start    },
+            { "duration_ms", phase.duration },
+            { "depth",       phase.depth    },
+        });
+    }
+
+    std::ofstream file(s_benchmarkPath, std::ios::trunc);
+    if (!(file << report.dump(2))) {
+        std::cerr << "[startup] Failed to write " << s_benchmarkPath << std::endl;
+    }
+}
+} // namespace
+
+void StartupProfile::Initialize(int argc, char** argv)
+{
+    for (int i = 1; i < argc; i++) {
+        const std::string arg = argv[i];
+        if (arg.rfind("--startup-benchmark=", 0) == 0 && arg.size() > 20) {
+            s_benchmarkPath = arg.substr(20);
+        }
+    }
+}
+
+bool StartupProfile::IsBenchmark()
+{
+    return !s_benchmarkPath.empty();
+}
+
+void StartupProfile::FirstFrameShown()
+{
+    if (s_firstFrameShown.exchange(true)) {
+        return;
+    }
+
+    const double firstFrame = MillisecondsSinceEntry();
+    std::vector<PhaseRecord> phases;
+    {
+        std::lock_guard<std::mutex> lock(s_mutex);
+        phases = s_phases;
+    }
+    std::sort(phases.begin(), phases.end(), [](const PhaseRecord& a, const PhaseRecord& b) { return a.start < b.start; });
+
+    /** Top-level phases run one after another across the main and renderer threads, so whatever they don't cover is untracked work */
+    double tracked = 0.0;
+    std::cout << std::format("[startup] First frame shown after {:.1f} ms", firstFrame) << std::endl;
+    for (const PhaseRecord& phase : phases) {
+        if (phase.depth == 0) {
+            tracked += phase.duration;
+        }
+        std::cout << std::format("[startup] {:>8.1f} ms {:>8.1f} ms  {}{}", phase.start, phase.duration, std::string(phase.depth * 2, ' '), phase.name) << std::endl;
+    }
+    std::cout << std::format("[startup] {:>11} {:>8.1f} ms  (untracked)", "", std::max(0.0, firstFrame - tracked)) << std::endl;
+
+    if (IsBenchmark()) {
+        WriteBenchmarkReport(firstFrame, phases);
+    }
+}
+
+StartupProfile::Phase::Phase(const char* name)
+    : m_name(name), m_start(MillisecondsSinceEntry()), m_depth(t_depth++), m_trace(name, "startup")
+{
+}
+
+StartupProfile::Phase::~Phase()
+{
+    t_depth--;
+    if (s_firstFrameShown.load(std::memory_order_relaxed)) {
+        return;
+    }
+
+    const double end = MillisecondsSinceEntry();
+    std::lock_guard<std::mutex> lock(s_mutex);
+    s_phases.push_back({ m_name, m_start, end - m_start, m_depth });
+}
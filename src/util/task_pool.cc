@@ -0,0 +1,158 @@
+/**
+ * ==================================================
+ *   _____ _ _ _             _
+ *  |     |_| | |___ ___ ___|_|_ _ _____
+ *  | | | | | | | -_|   |   | | | |     |
+ *  |_|_|_|_|_|_|___|_|_|_|_|_|___|_|_|_|
+ *
+ * ==================================================
+ *
+ * Copyright (c) 2025 Project Millennium
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <task_pool.h>
+#include <trace.h>
+#include <algorithm>
+#include <string>
+
+namespace
+{
+/** The pool and queue the calling thread works for, so submit() from a task stays on that worker's queue */
+thread_local const TaskPool* t_pool = nullptr;
+thread_local size_t t_queueIndex = 0;
+} // namespace
+
+TaskPool::TaskPool(size_t threadCount)
+{
+    if (threadCount == 0) {
+        threadCount = std::clamp<size_t>(std::thread::hardware_concurrency(), 2, 8);
+    }
+
+    m_queues.reserve(threadCount);
+    for (size_t i = 0; i < threadCount; i++) {
+        m_queues.push_back(std::make_unique<Queue>());
+    }
+
+    m_threads.reserve(threadCount);
+    for (size_t i = 0; i < threadCount; i++) {
+        m_threads.emplace_back(&TaskPool::workerLoop, this, i);
+    }
+}
+
+TaskPool::~TaskPool()
+{
+    wait();
+    {
+        std::lock_guard<std::mutex> lock(m_wakeMutex);
+        m_stopping = true;
+    }
+    m_wake.notify_all();
+
+    for (std::thread& thread : m_threads) {
+        thread.join();
+    }
+}
+
+void TaskPool::submit(Task task)
+{
+    const size_t index = t_pool == this ? t_queueIndex : m_nextQueue.fetch_add(1, std::memory_order_relaxed) % m_queues.size();
+
+    m_pending.fetch_add(1, std::memory_order_acq_rel);
+    {
+        std::lock_guard<std::mutex> lock(m_queues[index]->mutex);
+        m_queues[index]->tasks.push_back(std::move(task));
+    }
+    m_queued.fetch_add(1, std::memory_order_release);
+
+    /** Taking the lock orders this against a worker that just checked m_queued and is about to sleep */
+    {
+        std::lock_guard<std::mutex> lock(m_wakeMutex);
+    }
+    m_wake.notify_one();
+}
+
+void TaskPool::wait()
+{
+    std::unique_lock<std::mutex> lock(m_doneMutex);
+    m_done.wait(lock, [this] { return m_pending.load(std::memory_order_acquire) == 0; });
+}
+
+bool TaskPool::waitFor(std::chrono::milliseconds timeout)
+{
+    std::unique_lock<std::mutex> lock(m_doneMutex);
+    return m_done.wait_for(lock, timeout, [this] { return m_pending.load(std::memory_order_acquire) == 0; });
+}
+
+bool TaskPool::popLocal(size_t index, Task& task)
+{
+    Queue& queue = *m_queues[index];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if (queue.tasks.empty()) {
+        return false;
+    }
+    task = std::move(queue.tasks.back());
+    queue.tasks.pop_back();
+    return true;
+}
+
+bool TaskPool::steal(size_t index, Task& task)
+{
+    for (size_t offset = 1; offset < m_queues.size(); offset++) {
+        Queue& queue = *m_queues[(index + offset) % m_queues.size()];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (!queue.tasks.empty()) {
+            task = std::move(queue.tasks.front());
+            queue.tasks.pop_front();
+            return true;
+        }
+    }
+    return false;
+}
+
+void TaskPool::workerLoop(size_t index)
+{
+    t_pool = this;
+    t_queueIndex = index;
+
+    const std::string threadName = "pool-" + std::to_string(index);
+    Trace::SetThreadName(threadName.c_str());
+
+    while (true) {
+        Task task;
+        if (popLocal(index, task) || steal(index, task)) {
+            m_queued.fetch_sub(1, std::memory_order_acq_rel);
+            task();
+            task = nullptr;
+
+            if (m_pending.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                std::lock_guard<std::mutex> lock(m_doneMutex);
+                m_done.notify_all();
+            }
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(m_wakeMutex);
+        m_wake.wait(lock, [this] { return m_stopping || m_queued.load(std::memory_order_acquire) > 0; });
+        if (m_stopping) {
+            return;
+        }
+    }
+}
@@ -0,0 +1,329 @@
+/**
+ * ==================================================
+ *   _____ _ _ _             _
+ *  |     |_| | |___ ___ ___|_|_ _ _____
+ *  | | | | | | | -_|   |   | | | |     |
+ *  |_|_|_|_|_|_|___|_|_|_|_|_|___|_|_|_|
+ *
+ * ==================================================
+ *
+ * Copyright (c) 2025 Project Millennium
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <trace.h>
+#include <atomic>
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <vector>
+#include <nlohmann/json.hpp>
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace
+{
+constexpr size_t RING_CAPACITY = 1 << 14; // per thread, must be a power of two
+constexpr size_t DETAIL_LENGTH = 64;
+
+struct TraceEvent
+{
+    const char* name;
+    const char* category;
+    uint64_t timestamp; // microseconds since tracing started
+    uint64_t duration;
+    double value;
+    char phase; // 'X' complete span, 'C' counter, 'i' instant
+    char detail[DETAIL_LENGTH];
+};
+
+static_assert(std::is_trivially_copyable_v<TraceEvent>, "events are copied through EventSlot::words");
+
+constexpr size_t EVENT_WORDS = (sizeof(TraceEvent) + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+
+/**
+ * One ring entry, guarded like a seqlock. The writer of event `n` sets `sequence` to 2n+1, stores the payload and
+ * publishes 2n+2; a reader keeps its copy only if it saw 2n+2 both before and after copying. The payload is held in
+ * relaxed atomics so a copy that overlaps a wrapping writer is merely torn and discarded, never a data race.
+ */
+struct EventSlot
+{
+    std::atomic<uint64_t> sequence{ 0 };
+    std::array<std::atomic<uint64_t>, EVENT_WORDS> words;
+};
+
+/**
+ * Single-producer ring: only the owning thread writes, the flushing thread reads.
+ * When the ring wraps the oldest events are overwritten, so a long install keeps its most recent history.
+ */
+struct ThreadBuffer
+{
+    uint32_t tid = 0;
+    std::string threadName;
+    std::atomic<uint64_t> head{ 0 };
+    std::array<EventSlot, RING_CAPACITY> slots;
+};
+
+std::atomic<bool> g_enabled{ false };
+std::string g_outputPath;
+const auto g_epoch = std::chrono::steady_clock::now();
+
+std::mutex g_registryMutex;
+std::vector<std::shared_ptr<ThreadBuffer>> g_registry;
+std::atomic<uint32_t> g_nextTid{ 1 };
+
+uint64_t NowMicros()
+{
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - g_epoch).count());
+}
+
+/** Registration happens once per thread; every later event is lock-free. */
+ThreadBuffer& GetThreadBuffer()
+{
+    thread_local std::shared_ptr<ThreadBuffer> buffer = []()
+    {
+        auto newBuffer = std::make_shared<ThreadBuffer>();
+        newBuffer->tid = g_nextTid.fetch_add(1, std::memory_order_relaxed);
+
+        std::lock_guard<std::mutex> lock(g_registryMutex);
+        g_registry.push_back(newBuffer);
+        return newBuffer;
+    }();
+    return *buffer;
+}
+
+void PushEvent(char phase, const char* name, const char* category, uint64_t timestamp, uint64_t duration, double value, const std::string& detail)
+{
+    ThreadBuffer& buffer = GetThreadBuffer();
+    const uint64_t index = buffer.head.load(std::memory_order_relaxed);
+
+    TraceEvent event{};
+    event.name = name;
+    event.category = category;
+    event.timestamp = timestamp;
+    event.duration = duration;
+    event.value = value;
+    event.phase = phase;
+
+    const size_t length = std::min(detail.size(), DETAIL_LENGTH - 1);
+    std::memcpy(event.detail, detail.data(), length);
+    event.detail[length] = '\0';
+
+    uint64_t words[EVENT_WORDS] = {};
+    std::memcpy(words, &event, sizeof(event));
+
+    EventSlot& slot = buffer.slots[index & (RING_CAPACITY - 1)];
+    slot.sequence.store(index * 2 + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    for (size_t i = 0; i < EVENT_WORDS; i++) {
+        slot.words[i].store(words[i], std::memory_order_relaxed);
+    }
+    slot.sequence.store(index * 2 + 2, std::memory_order_release);
+
+    buffer.head.store(index + 1, std::memory_order_release);
+}
+
+/** Copy event `index` out of its slot. False if the writer has moved past it or is rewriting the slot right now. */
+bool ReadEvent(const ThreadBuffer& buffer, uint64_t index, TraceEvent& event)
+{
+    const EventSlot& slot = buffer.slots[index & (RING_CAPACITY - 1)];
+    const uint64_t expected = index * 2 + 2;
+
+    if (slot.sequence.load(std::memory_order_acquire) != expected) {
+        return false;
+    }
+
+    uint64_t words[EVENT_WORDS];
+    for (size_t i = 0; i < EVENT_WORDS; i++) {
+        words[i] = slot.words[i].load(std::memory_order_relaxed);
+    }
+    std::atomic_thread_fence(std::memory_order_acquire);
+
+    if (slot.sequence.load(std::memory_order_relaxed) != expected) {
+        return false;
+    }
+
+    std::memcpy(&event, words, sizeof(event));
+    return true;
+}
+
+int GetProcessId()
+{
+#ifdef _WIN32
+    return static_cast<int>(GetCurrentProcessId());
+#else
+    return static_cast<int>(getpid());
+#endif
+}
+} // namespace
+
+void Trace::Initialize(const std::string& outputPath)
+{
+    std::string path = outputPath;
+
+    if (path.empty()) {
+        const char* envPath = std::getenv("MILLENNIUM_TRACE");
+        if (!envPath || *envPath == '\0') {
+            return;
+        }
+        path = envPath;
+    }
+
+    g_outputPath = path;
+    g_enabled.store(true, std::memory_order_release);
+    std::atexit([]() { Flush(); });
+
+    std::cerr << "[trace] recording install trace to '" << g_outputPath << "'" << std::endl;
+}
+
+bool Trace::IsEnabled()
+{
+    return g_enabled.load(std::memory_order_relaxed);
+}
+
+void Trace::SetThreadName(const char* name)
+{
+    if (!IsEnabled()) {
+        return;
+    }
+
+    ThreadBuffer& buffer = GetThreadBuffer();
+    std::lock_guard<std::mutex> lock(g_registryMutex);
+    buffer.threadName = name;
+}
+
+void Trace::Counter(const char* name, double value)
+{
+    if (!IsEnabled()) {
+        return;
+    }
+    PushEvent('C', name, "counter", NowMicros(), 0, value, {});
+}
+
+void Trace::Instant(const char* name, const char* category)
+{
+    if (!IsEnabled()) {
+        return;
+    }
+    PushEvent('i', name, category, NowMicros(), 0, 0.0, {});
+}
+
+bool Trace::Flush()
+{
+    if (!IsEnabled()) {
+        return false;
+    }
+
+    const int pid = GetProcessId();
+    nlohmann::json traceEvents = nlohmann::json::array();
+
+    {
+        std::lock_guard<std::mutex> lock(g_registryMutex);
+
+        for (const auto& buffer : g_registry) {
+            if (!buffer->threadName.empty()) {
+                traceEvents.push_back({
+                    { "ph",   "M"                                         },
+                    { "name", "thread_name"                               },
+                    { "pid",  pid                                         },
+                    { "tid",  buffer->tid                                 },
+                    { "args", { { "name", buffer->threadName } } },
+                });
+            }
+
+            const uint64_t head = buffer->head.load(std::memory_order_acquire);
+            const uint64_t first = head > RING_CAPACITY ? head - RING_CAPACITY : 0;
+
+            for (uint64_t i = first; i < head; i++) {
+                TraceEvent event;
+                if (!ReadEvent(*buffer, i, event)) {
+                    continue;
+                }
+
+                nlohmann::json entry = {
+                    { "ph",   std::string(1, event.phase) },
+                    { "name", event.name                  },
+                    { "cat",  event.category              },
+                    { "ts",   event.timestamp             },
+                    { "pid",  pid                         },
+                    { "tid",  buffer->tid                 },
+                };
+
+                switch (event.phase) {
+                    case 'X':
+                        entry["dur"] = event.duration;
+                        if (event.detail[0] != '\0') {
+                            entry["args"] = { { "detail", event.detail } };
+                        }
+                        break;
+                    case 'C':
+                        entry["args"] = { { "value", event.value } };
+                        break;
+                    case 'i':
+                        entry["s"] = "t";
+                        break;
+                }
+
+                traceEvents.push_back(std::move(entry));
+            }
+        }
+    }
+
+    std::ofstream file(g_outputPath, std::ios::binary | std::ios::trunc);
+    if (!file) {
+        std::cerr << "[trace] failed to open '" << g_outputPath << "' for writing" << std::endl;
+        return false;
+    }
+
+    const nlohmann::json document = {
+        { "traceEvents",     traceEvents },
+        { "displayTimeUnit", "ms"        },
+    };
+    file << document.dump(-1, ' ', false, nlohmann::json::error_handler_t::replace);
+
+    std::cout << "[trace] wrote " << traceEvents.size() << " events to '" << g_outputPath << "'" << std::endl;
+    return true;
+}
+
+Trace::Scope::Scope(const char* name, const char* category, const std::string& detail)
+    : m_name(name), m_category(category), m_start(0), m_active(IsEnabled())
+{
+    if (m_active) {
+        m_detail = detail;
+        m_start = NowMicros();
+    }
+}
+
+Trace::Scope::~Scope()
+{
+    if (m_active) {
+        PushEvent('X', m_name, m_category, m_start, NowMicros() - m_start, 0.0, m_detail);
+    }
+}
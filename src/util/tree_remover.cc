@@ -0,0 +1,207 @@
+/**
+ * ==================================================
+ *   _____ _ _ _             _
+ *  |     |_| | |___ ___ ___|_|_ _ _____
+ *  | | | | | | | -_|   |   | | | |     |
+ *  |_|_|_|_|_|_|___|_|_|_|_|_|___|_|_|_|
+ *
+ * ==================================================
+ *
+ * Copyright (c) 2025 Project Millennium
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <tree_remover.h>
+#include <size_scanner.h>
+#include <trace.h>
+#include <algorithm>
+
+namespace
+{
+/** How often removed counts are reported while files are being deleted */
+constexpr std::chrono::milliseconds kReportInterval{ 100 };
+
+/** Files per deletion task: enough to amortize the task, few enough to spread a single big directory over the pool */
+constexpr size_t kFilesPerTask = 64;
+
+size_t Depth(const std::filesystem::path& path)
+{
+    return static_cast<size_t>(std::distance(path.begin(), path.end()));
+}
+} // namespace
+
+TreeRemover::TreeRemover(const std::vector<std::vector<std::filesystem::path>>& groups)
+{
+    TRACE_SCOPE("TreeRemover::enumerate", "uninstaller");
+
+    m_groups.reserve(groups.size());
+    for (size_t i = 0; i < groups.size(); i++) {
+        m_groups.push_back(std::make_unique<Group>());
+    }
+
+    for (size_t i = 0; i < groups.size(); i++) {
+        Group& group = *m_groups[i];
+
+        for (const std::filesystem::path& root : groups[i]) {
+            std::error_code ec;
+            const std::filesystem::directory_entry entry(root, ec);
+            const bool isLink = !ec && IsLinkEntry(entry, ec);
+
+            /** Already gone counts as removed; a dangling link still has to go */
+            if (ec || (!isLink && !entry.exists(ec))) {
+                continue;
+            }
+
+            std::lock_guard<std::mutex> lock(group.mutex);
+            if (!isLink && entry.is_directory(ec)) {
+                group.directories.push_back(root);
+                m_pool.submit([this, &group, root] { enumerate(group, root); });
+            } else {
+                /** Removing a link frees none of its target's bytes */
+                const uint64_t size = !isLink && entry.is_regular_file(ec) ? entry.file_size(ec) : 0;
+                group.files.push_back({ root, ec ? 0 : size });
+            }
+        }
+    }
+    m_pool.wait();
+
+    m_totals.resize(m_groups.size());
+    for (size_t i = 0; i < m_groups.size(); i++) {
+        for (const File& file : m_groups[i]->files) {
+            m_totals[i].bytes += file.size;
+        }
+        m_totals[i].files = m_groups[i]->files.size();
+    }
+}
+
+/** Pool task: record the entries of `directory` and queue a task for each real subdirectory. */
+void TreeRemover::enumerate(Group& group, const std::filesystem::path& directory)
+{
+    std::vector<File> files;
+    std::vector<std::filesystem::path> directories;
+
+    std::error_code ec;
+    std::filesystem::directory_iterator it(directory, ec);
+    for (const std::filesystem::directory_iterator end; !ec && it != end; it.increment(ec)) {
+        const std::filesystem::directory_entry& entry = *it;
+
+        std::error_code entryError;
+        const bool isLink = IsLinkEntry(entry, entryError);
+        if (!isLink && entry.is_directory(entryError)) {
+            directories.push_back(entry.path());
+            m_pool.submit([this, &group, path = entry.path()] { enumerate(group, path); });
+            continue;
+        }
+
+        const uint64_t size = !isLink && entry.is_regular_file(entryError) ? entry.file_size(entryError) : 0;
+        files.push_back({ entry.path(), entryError ? 0 : size });
+    }
+
+    std::lock_guard<std::mutex> lock(group.mutex);
+    if (ec) {
+        /** The directory itself will fail to delete too; this is the more useful error to show */
+        group.failures.push_back({ directory, ec.message() });
+    }
+    group.files.insert(group.files.end(), std::make_move_iterator(files.begin()), std::make_move_iterator(files.end()));
+    group.directories.insert(group.directories.end(), std::make_move_iterator(directories.begin()), std::make_move_iterator(directories.end()));
+}
+
+/** Pool task: delete group.files[first, last). */
+void TreeRemover::removeFiles(Group& group, size_t first, size_t last)
+{
+    for (size_t i = first; i < last; i++) {
+        const File& file = group.files[i];
+
+        std::error_code ec;
+        std::filesystem::remove(file.path, ec);
+        if (ec) {
+            std::lock_guard<std::mutex> lock(group.mutex);
+            group.failures.push_back({ file.path, ec.message() });
+            continue;
+        }
+
+        /** Publish per file so a batch of large files still moves the progress along */
+        group.removedBytes.fetch_add(file.size, std::memory_order_relaxed);
+        group.removedFiles.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+/** Deepest first, so every directory is empty by the time it is removed. */
+void TreeRemover::removeDirectories(Group& group)
+{
+    std::sort(group.directories.begin(), group.directories.end(), [](const std::filesystem::path& a, const std::filesystem::path& b) { return Depth(a) > Depth(b); });
+
+    const bool hadFailures = !group.failures.empty();
+    for (const std::filesystem::path& directory : group.directories) {
+        std::error_code ec;
+        std::filesystem::remove(directory, ec);
+
+        /** A directory left non-empty by a file that failed was already reported through that file */
+        if (ec && !(hadFailures && ec == std::errc::directory_not_empty)) {
+            group.failures.push_back({ directory, ec.message() });
+        }
+    }
+}
+
+std::vector<TreeRemover::Counts> TreeRemover::snapshot() const
+{
+    std::vector<Counts> counts(m_groups.size());
+    for (size_t i = 0; i < m_groups.size(); i++) {
+        counts[i].bytes = m_groups[i]->removedBytes.load(std::memory_order_relaxed);
+        counts[i].files = m_groups[i]->removedFiles.load(std::memory_order_relaxed);
+    }
+    return counts;
+}
+
+std::vector<TreeRemover::GroupResult> TreeRemover::run(const Progress& onProgress)
+{
+    TRACE_SCOPE("TreeRemover::run", "uninstaller");
+
+    for (const std::unique_ptr<Group>& group : m_groups) {
+        Group* target = group.get();
+        for (size_t first = 0; first < target->files.size(); first += kFilesPerTask) {
+            const size_t last = std::min(first + kFilesPerTask, target->files.size());
+            m_pool.submit([this, target, first, last] { removeFiles(*target, first, last); });
+        }
+    }
+
+    std::vector<Counts> reported(m_groups.size());
+    while (!m_pool.waitFor(kReportInterval)) {
+        std::vector<Counts> removed = snapshot();
+        if (removed != reported) {
+            onProgress(removed);
+            reported = std::move(removed);
+        }
+    }
+
+    for (const std::unique_ptr<Group>& group : m_groups) {
+        removeDirectories(*group);
+    }
+
+    const std::vector<Counts> removed = snapshot();
+    onProgress(removed);
+
+    std::vector<GroupResult> results(m_groups.size());
+    for (size_t i = 0; i < m_groups.size(); i++) {
+        results[i].removed = removed[i];
+        results[i].failures = std::move(m_groups[i]->failures);
+    }
+    return results;
+}
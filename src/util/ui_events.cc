@@ -0,0 +1,80 @@
+/**
+ * ==================================================
+ *   _____ _ _ _             _
+ *  |     |_| | |___ ___ ___|_|_ _ _____
+ *  | | | | | | | -_|   |   | | | |     |
+ *  |_|_|_|_|_|_|___|_|_|_|_|_|___|_|_|_|
+ *
+ * ==================================================
+ *
+ * Copyright (c) 2025 Project Millennium
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <ui_events.h>
+#include <frame_scheduler.h>
+#include <atomic>
+
+namespace
+{
+struct EventNode
+{
+    UiEvents::Event event;
+    EventNode* next;
+};
+
+/**
+ * Newest-first stack of posted events. Producers push with a CAS, and the renderer takes the whole list at once with
+ * an exchange, so nodes are never popped individually and ABA can't occur. Reversing the taken list restores post order.
+ */
+std::atomic<EventNode*> s_head{ nullptr };
+} // namespace
+
+void UiEvents::Post(Event event)
+{
+    EventNode* node = new EventNode{ std::move(event), s_head.load(std::memory_order_relaxed) };
+    while (!s_head.compare_exchange_weak(node->next, node, std::memory_order_release, std::memory_order_relaxed)) {
+    }
+    FrameScheduler::RequestFrame();
+}
+
+bool UiEvents::Drain()
+{
+    EventNode* pending = s_head.exchange(nullptr, std::memory_order_acquire);
+    if (!pending) {
+        return false;
+    }
+
+    EventNode* ordered = nullptr;
+    while (pending) {
+        EventNode* next = pending->next;
+        pending->next = ordered;
+        ordered = pending;
+        pending = next;
+    }
+
+    while (ordered) {
+        EventNode* next = ordered->next;
+        ordered->event();
+        delete ordered;
+        ordered = next;
+    }
+    return true;
+}
@@ -28,9 +28,17 @@
  * SOFTWARE.
  */
 
+#include <updater.h>
 #include <string>
+#include <string_view>
 #include <filesystem>
+#include <atomic>
+#include <thread>
 #include <http.h>
+#include <release_source.h>
+#include <frame_scheduler.h>
+#include <components.h>
+#include <trace.h>
 #include <nlohmann/json.hpp>
 #include <semver.h>
 #include <iostream>
@@ -40,31 +48,59 @@
 
 namespace fs = std::filesystem;
 
-void CheckForAndDownloadUpdates()
+namespace
+{
+std::atomic<Updater::Status> s_status{ Updater::Status::Idle };
+std::atomic<bool> s_running{ false };
+std::atomic<bool> s_dismissed{ false };
+
+/** Written by the check thread before it publishes ReadyToRestart, and only read after observing it */
+std::string s_availableVersion;
+fs::path s_stagedPath;
+
+void SetStatus(Updater::Status status)
+{
+    s_status.store(status, std::memory_order_release);
+    FrameScheduler::RequestFrame();
+}
+
+#ifdef _WIN32
+fs::path GetCurrentExecutablePath()
+{
+    wchar_t path[MAX_PATH];
+    GetModuleFileNameW(NULL, path, MAX_PATH);
+    return fs::path(path);
+}
+
+fs::path GetUpdateDirectory()
+{
+    return fs::temp_directory_path() / "MillenniumInstallerUpdate";
+}
+
+/** Renderer thread: the user asked for the update, so unlike a failed background check this is worth telling them about */
+void RestartFailed()
+{
+    SetStatus(Updater::Status::Failed);
+    ShowMessageBox("Whoops!", "Failed to install the installer update. You can keep using this version, or download the latest release manually.", Error);
+}
+
+/** Runs on the update thread: find a newer release and download it next to, not over, the running executable. */
+Updater::Status CheckForAndDownloadUpdates()
 {
-#ifndef _WIN32
-    return; // self-update not implemented on Linux
-#else
     auto NormalizeVersion = [](const std::string& version) -> std::string {
         if (!version.empty() && (version[0] == 'v' || version[0] == 'V'))
             return version.substr(1);
         return version;
     };
 
-    auto GetCurrentExecutablePath = []() -> fs::path {
-        wchar_t path[MAX_PATH];
-        GetModuleFileNameW(NULL, path, MAX_PATH);
-        return fs::path(path);
-    };
-
     const std::string currentVersion = MILLENNIUM_VERSION;
-    const std::string apiUrl = "https://api.github.com/repos/SteamClientHomebrew/Installer/releases";
 
-    // Fetch releases from GitHub API
-    std::string response = Http::Get(apiUrl.c_str(), false);
+    // Fetch releases from the configured release source (GitHub by default)
+    const auto apiResponse = ReleaseSource::Get("/repos/SteamClientHomebrew/Installer/releases");
+    const std::string response = apiResponse.ok() ? apiResponse.body : std::string();
     if (response.empty()) {
         std::cerr << "Failed to fetch update information from GitHub." << std::endl;
-        return;
+        return Updater::Status::Failed;
     }
 
     nlohmann::json releases;
@@ -72,19 +108,19 @@ void CheckForAndDownloadUpdates()
         releases = nlohmann::json::parse(response);
     } catch (const nlohmann::json::parse_error& e) {
         std::cerr << "Failed to parse GitHub API response: " << e.what() << std::endl;
-        return;
+        return Updater::Status::Failed;
     }
 
     if (!releases.is_array() || releases.empty()) {
         std::cerr << "No releases found." << std::endl;
-        return;
+        return Updater::Status::Failed;
     }
 
     // Get the latest release (first in the array, as GitHub returns them sorted by date)
     const auto& latestRelease = releases[0];
     if (!latestRelease.contains("tag_name")) {
         std::cerr << "Invalid release format." << std::endl;
-        return;
+        return Updater::Status::Failed;
     }
 
     std::string latestVersion = latestRelease["tag_name"].get<std::string>();
@@ -93,17 +129,18 @@ void CheckForAndDownloadUpdates()
     try {
         if (semver::cmp(NormalizeVersion(currentVersion), NormalizeVersion(latestVersion)) >= 0) {
             std::cout << "Installer is up to date (current: " << currentVersion << ", latest: " << latestVersion << ")." << std::endl;
-            return;
+            return Updater::Status::UpToDate;
         }
     } catch (const std::exception& e) {
         std::cerr << "Failed to compare versions: " << e.what() << std::endl;
-        return;
+        return Updater::Status::Failed;
     }
 
     std::cout << "Update available: " << currentVersion << " -> " << latestVersion << std::endl;
 
     // Find the Windows executable asset
     std::string downloadUrl;
+    std::string expectedDigest;
     if (latestRelease.contains("assets") && latestRelease["assets"].is_array()) {
         for (const auto& asset : latestRelease["assets"]) {
             if (!asset.contains("name") || !asset.contains("browser_download_url")) {
@@ -113,6 +150,9 @@ void CheckForAndDownloadUpdates()
             // Look for the Windows installer executable
             if (assetName.find(".exe") != std::string::npos) {
                 downloadUrl = asset["browser_download_url"].get<std::string>();
+                if (asset.contains("digest") && asset["digest"].is_string()) {
+                    expectedDigest = asset["digest"].get<std::string>();
+                }
                 break;
             }
         }
@@ -120,24 +160,118 @@ void CheckForAndDownloadUpdates()
 
     if (downloadUrl.empty()) {
         std::cerr << "Could not find installer executable in latest release." << std::endl;
-        return;
+        return Updater::Status::Failed;
+    }
+
+    // The staged file replaces the running installer, so it is held to the same digest check as release archives
+    constexpr std::string_view digestPrefix = "sha256:";
+    if (!expectedDigest.starts_with(digestPrefix)) {
+        std::cerr << "Installer executable in latest release has no sha256 digest." << std::endl;
+        return Updater::Status::Failed;
     }
+    expectedDigest.erase(0, digestPrefix.size());
 
-    // Get paths
-    fs::path currentExePath = GetCurrentExecutablePath();
-    fs::path tempDir = fs::temp_directory_path() / "MillenniumInstallerUpdate";
-    fs::path oldExePath = tempDir / ("old_" + currentExePath.filename().string());
-    fs::path newExePath = currentExePath;
+    const fs::path tempDir = GetUpdateDirectory();
+    const fs::path stagedPath = tempDir / ("new_" + GetCurrentExecutablePath().filename().string());
+    const fs::path partialPath = stagedPath.string() + ".partial";
 
     // Create temp directory if it doesn't exist
     try {
         fs::create_directories(tempDir);
     } catch (const fs::filesystem_error& e) {
         std::cerr << "Failed to create temp directory: " << e.what() << std::endl;
+        return Updater::Status::Failed;
+    }
+
+    SetStatus(Updater::Status::Downloading);
+
+    // Download the new version; a download cut short by exiting only ever leaves the .partial file behind
+    std::cout << "Downloading update from: " << downloadUrl << std::endl;
+    if (!ReleaseSource::DownloadFile(downloadUrl, partialPath.string(), 0, nullptr, false, false)) {
+        std::cerr << "Failed to download update." << std::endl;
+        return Updater::Status::Failed;
+    }
+
+    if (!VerifyDownloadSignature(partialPath.string(), expectedDigest)) {
+        std::cerr << "Downloaded update does not match the release digest." << std::endl;
+        std::error_code ec;
+        fs::remove(partialPath, ec);
+        return Updater::Status::Failed;
+    }
+
+    try {
+        fs::rename(partialPath, stagedPath);
+    } catch (const fs::filesystem_error& e) {
+        std::cerr << "Failed to stage update: " << e.what() << std::endl;
+        return Updater::Status::Failed;
+    }
+
+    std::cout << "Update " << latestVersion << " downloaded and ready to install on restart." << std::endl;
+    s_availableVersion = latestVersion;
+    s_stagedPath = stagedPath;
+    return Updater::Status::ReadyToRestart;
+}
+#endif // _WIN32
+} // namespace
+
+void Updater::BeginCheck()
+{
+#ifndef _WIN32
+    return; // self-update not implemented on Linux
+#else
+    if (s_running.exchange(true)) {
         return;
     }
+    SetStatus(Status::Checking);
+
+    /** Detached so closing the window never waits on the network; see IsRunning() */
+    std::thread([]()
+    {
+        Trace::SetThreadName("updater");
+        const Status status = CheckForAndDownloadUpdates();
+        SetStatus(status);
+        s_running.store(false, std::memory_order_release);
+    }).detach();
+#endif
+}
+
+Updater::Status Updater::GetStatus()
+{
+    return s_status.load(std::memory_order_acquire);
+}
+
+std::string Updater::GetAvailableVersion()
+{
+    return GetStatus() == Status::ReadyToRestart ? s_availableVersion : std::string();
+}
+
+bool Updater::IsRunning()
+{
+    return s_running.load(std::memory_order_acquire);
+}
 
-    // Move current installer to temp folder
+void Updater::Dismiss()
+{
+    s_dismissed.store(true, std::memory_order_relaxed);
+    FrameScheduler::RequestFrame();
+}
+
+bool Updater::IsDismissed()
+{
+    return s_dismissed.load(std::memory_order_relaxed);
+}
+
+void Updater::RestartIntoUpdate()
+{
+#ifdef _WIN32
+    if (GetStatus() != Status::ReadyToRestart) {
+        return;
+    }
+
+    const fs::path currentExePath = GetCurrentExecutablePath();
+    const fs::path oldExePath = GetUpdateDirectory() / ("old_" + currentExePath.filename().string());
+
+    // Move current installer to temp folder; Windows allows renaming a running executable, not overwriting it
     try {
         if (fs::exists(oldExePath)) {
             fs::remove(oldExePath);
@@ -145,46 +279,47 @@ void CheckForAndDownloadUpdates()
         fs::rename(currentExePath, oldExePath);
     } catch (const fs::filesystem_error& e) {
         std::cerr << "Failed to move current installer to temp folder: " << e.what() << std::endl;
+        RestartFailed();
         return;
     }
 
-    // Download the new version
-    std::cout << "Downloading update from: " << downloadUrl << std::endl;
-    bool downloadSuccess = Http::downloadFile(downloadUrl, newExePath.string(), 0, nullptr, false);
-
-    if (!downloadSuccess) {
-        std::cerr << "Failed to download update. Restoring old version..." << std::endl;
-        // Restore old version
+    try {
+        fs::rename(s_stagedPath, currentExePath);
+    } catch (const fs::filesystem_error& e) {
+        std::cerr << "Failed to move update into place: " << e.what() << ". Restoring old version..." << std::endl;
         try {
             fs::rename(oldExePath, currentExePath);
-        } catch (const fs::filesystem_error& e) {
-            std::cerr << "Failed to restore old version: " << e.what() << std::endl;
+        } catch (const fs::filesystem_error& restoreError) {
+            std::cerr << "Failed to restore old version: " << restoreError.what() << std::endl;
         }
+        RestartFailed();
         return;
     }
 
-    std::cout << "Update downloaded successfully. Launching new version..." << std::endl;
+    std::cout << "Launching new version..." << std::endl;
 
     // Launch the new version
     STARTUPINFOW si = { sizeof(si) };
     PROCESS_INFORMATION pi;
 
-    std::wstring newExePathW = newExePath.wstring();
+    std::wstring newExePathW = currentExePath.wstring();
     if (CreateProcessW(newExePathW.c_str(), NULL, NULL, NULL, FALSE, 0, NULL, NULL, &si, &pi)) {
         CloseHandle(pi.hProcess);
         CloseHandle(pi.hThread);
 
         // Exit the current process
+        Trace::Flush();
         ExitProcess(0);
     } else {
         std::cerr << "Failed to launch new version. Error: " << GetLastError() << std::endl;
         // Restore old version since we couldn't launch the new one
         try {
-            fs::remove(newExePath);
+            fs::remove(currentExePath);
             fs::rename(oldExePath, currentExePath);
         } catch (const fs::filesystem_error& e) {
             std::cerr << "Failed to restore old version: " << e.what() << std::endl;
         }
+        RestartFailed();
     }
 #endif // _WIN32
-}
\ No newline at end of file
+}
@@ -0,0 +1,160 @@
+/**
+ * ==================================================
+ *   _____ _ _ _             _
+ *  |     |_| | |___ ___ ___|_|_ _ _____
+ *  | | | | | | | -_|   |   | | | |     |
+ *  |_|_|_|_|_|_|___|_|_|_|_|_|___|_|_|_|
+ *
+ * ==================================================
+ *
+ * Copyright (c) 2025 Project Millennium
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <draw_snapshot.h>
+#include <imgui_internal.h>
+#include <algorithm>
+#include <climits>
+
+void DrawSnapshot::begin()
+{
+    clear();
+
+    ImGuiContext& g = *GImGui;
+    drawList = ImGui::GetWindowDrawList();
+    fontTexture = ImGui::GetIO().Fonts->TexData;
+    firstCommand = std::max(drawList->CmdBuffer.Size - 1, 0);
+    firstIndex = static_cast<unsigned int>(drawList->IdxBuffer.Size);
+    firstWindowOrder = g.WindowsActiveCount;
+}
+
+bool DrawSnapshot::end()
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiWindow* parent = g.CurrentWindow;
+
+    if (!recordCommands(drawList, firstCommand, firstIndex)) {
+        clear();
+        return false;
+    }
+
+    /** Child windows get their own draw lists, rendered after the parent's in the order they were begun */
+    std::vector<ImGuiWindow*> children;
+    for (ImGuiWindow* window : g.Windows) {
+        if (!window->Active || window->BeginOrderWithinContext < firstWindowOrder) {
+            continue;
+        }
+        if (!(window->Flags & ImGuiWindowFlags_ChildWindow) || window->RootWindow != parent->RootWindow || (window->Flags & (ImGuiWindowFlags_Popup | ImGuiWindowFlags_Tooltip))) {
+            clear();
+            return false;
+        }
+        if (!window->Hidden) {
+            children.push_back(window);
+        }
+    }
+    std::sort(children.begin(), children.end(), [](const ImGuiWindow* a, const ImGuiWindow* b) { return a->BeginOrderWithinContext < b->BeginOrderWithinContext; });
+
+    for (const ImGuiWindow* child : children) {
+        if (!recordCommands(child->DrawList, 0, 0)) {
+            clear();
+            return false;
+        }
+    }
+
+    drawList = nullptr;
+    return true;
+}
+
+/** Copy the indices from `startIndex` on, with the vertices they reference, one segment per draw command. */
+bool DrawSnapshot::recordCommands(const ImDrawList* source, int startCommand, unsigned int startIndex)
+{
+    for (int i = startCommand; i < source->CmdBuffer.Size; i++) {
+        const ImDrawCmd& command = source->CmdBuffer[i];
+        const unsigned int begin = std::max(command.IdxOffset, startIndex);
+        const unsigned int end = command.IdxOffset + command.ElemCount;
+        if (begin >= end) {
+            continue;
+        }
+        if (command.UserCallback) {
+            return false;
+        }
+
+        unsigned int lowest = UINT_MAX, highest = 0;
+        for (unsigned int index = begin; index < end; index++) {
+            lowest = std::min<unsigned int>(lowest, source->IdxBuffer[index]);
+            highest = std::max<unsigned int>(highest, source->IdxBuffer[index]);
+        }
+
+        Segment segment;
+        segment.clipRect = command.ClipRect;
+        segment.texture = command.TexRef;
+        segment.firstVertex = static_cast<unsigned int>(vertices.size());
+        segment.vertexCount = highest - lowest + 1;
+        segment.firstIndex = static_cast<unsigned int>(indices.size());
+        segment.indexCount = end - begin;
+
+        const ImDrawVert* vertexData = source->VtxBuffer.Data + command.VtxOffset;
+        vertices.insert(vertices.end(), vertexData + lowest, vertexData + highest + 1);
+        for (unsigned int index = begin; index < end; index++) {
+            indices.push_back(static_cast<ImDrawIdx>(source->IdxBuffer[index] - lowest));
+        }
+        segments.push_back(segment);
+    }
+    return true;
+}
+
+bool DrawSnapshot::replay(float xOffset) const
+{
+    if (segments.empty() || fontTexture != ImGui::GetIO().Fonts->TexData) {
+        return false;
+    }
+
+    ImDrawList* target = ImGui::GetWindowDrawList();
+    for (const Segment& segment : segments) {
+        /** Clip rects move with the geometry and are then clipped to the window again */
+        target->PushClipRect({ segment.clipRect.x + xOffset, segment.clipRect.y }, { segment.clipRect.z + xOffset, segment.clipRect.w }, true);
+        target->PushTexture(segment.texture);
+
+        target->PrimReserve(static_cast<int>(segment.indexCount), static_cast<int>(segment.vertexCount));
+        const unsigned int base = target->_VtxCurrentIdx;
+        for (unsigned int i = 0; i < segment.vertexCount; i++) {
+            ImDrawVert vertex = vertices[segment.firstVertex + i];
+            vertex.pos.x += xOffset;
+            *target->_VtxWritePtr++ = vertex;
+        }
+        for (unsigned int i = 0; i < segment.indexCount; i++) {
+            *target->_IdxWritePtr++ = static_cast<ImDrawIdx>(base + indices[segment.firstIndex + i]);
+        }
+        target->_VtxCurrentIdx += segment.vertexCount;
+
+        target->PopTexture();
+        target->PopClipRect();
+    }
+    return true;
+}
+
+void DrawSnapshot::clear()
+{
+    vertices.clear();
+    indices.clear();
+    segments.clear();
+    drawList = nullptr;
+    fontTexture = nullptr;
+}
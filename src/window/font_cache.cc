@@ -0,0 +1,513 @@
+/**
+ * ==================================================
+ *   _____ _ _ _             _
+ *  |     |_| | |___ ___ ___|_|_ _ _____
+ *  | | | | | | | -_|   |   | | | |     |
+ *  |_|_|_|_|_|_|___|_|_|_|_|_|___|_|_|_|
+ *
+ * ==================================================
+ *
+ * Copyright (c) 2025 Project Millennium
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <font_cache.h>
+#include <archive_cache.h>
+#include <mapped_file.h>
+#include <frame_scheduler.h>
+#include <trace.h>
+#include <imgui.h>
+#include <imgui_internal.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <format>
+#include <fstream>
+#include <iostream>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+namespace
+{
+/** "MFGC", bumped along with FORMAT_VERSION whenever the layout below changes */
+constexpr uint32_t FILE_MAGIC = 0x4347464D;
+constexpr uint32_t FORMAT_VERSION = 1;
+
+/** Newly baked glyphs are written once nothing new has been baked for this long */
+constexpr double SAVE_DELAY = 0.5;
+
+/** Sanity bound for a single glyph bitmap, anything larger means the file is corrupt */
+constexpr uint32_t MAX_GLYPH_EXTENT = 1024;
+
+struct FileHeader
+{
+    uint32_t magic;
+    uint32_t version;
+    uint64_t key;
+    uint32_t bakedCount;
+    uint32_t bytesPerPixel;
+};
+
+struct BakedRecord
+{
+    uint32_t fontIndex;
+    float size;
+    float density;
+    uint32_t glyphCount;
+};
+
+/** Followed by width * height * bytesPerPixel bytes of pixels, padded to 4 bytes */
+struct GlyphRecord
+{
+    uint32_t codepoint;
+    uint16_t width;
+    uint16_t height;
+    uint8_t colored;
+    uint8_t visible;
+    uint8_t sourceIndex;
+    uint8_t reserved;
+    float advanceX;
+    float x0, y0, x1, y1;
+};
+
+uint64_t s_key = 0;
+size_t s_savedGlyphs = 0;
+size_t s_lastGlyphCount = 0;
+std::chrono::steady_clock::time_point s_lastChange;
+
+size_t PaddedSize(size_t size)
+{
+    return (size + 3) & ~size_t(3);
+}
+
+struct Fnv1a
+{
+    uint64_t hash = 0xcbf29ce484222325ull;
+
+    void Mix(const void* data, size_t size)
+    {
+        const unsigned char* bytes = static_cast<const unsigned char*>(data);
+        for (size_t i = 0; i < size; i++) {
+            hash = (hash ^ bytes[i]) * 0x100000001b3ull;
+        }
+    }
+
+    /** FNV-1a over 8-byte words, for whole font files where the byte-wise loop would dominate a rebuild */
+    void MixContent(const void* data, size_t size)
+    {
+        const unsigned char* bytes = static_cast<const unsigned char*>(data);
+        const size_t wordBytes = size & ~size_t(7);
+        for (size_t i = 0; i < wordBytes; i += 8) {
+            uint64_t word;
+            std::memcpy(&word, bytes + i, sizeof(word));
+            hash = (hash ^ word) * 0x100000001b3ull;
+        }
+        Mix(bytes + wordBytes, size - wordBytes);
+    }
+
+    template <typename T> void MixValue(const T& value) { Mix(&value, sizeof(value)); }
+
+    void MixRanges(const ImWchar* ranges)
+    {
+        for (; ranges && ranges[0]; ranges += 2) {
+            Mix(ranges, sizeof(ImWchar) * 2);
+        }
+        MixValue(ImWchar(0));
+    }
+};
+
+/** Everything that changes the pixels or metrics of a baked glyph */
+uint64_t ComputeKey(ImFontAtlas* atlas)
+{
+    Fnv1a fnv;
+    fnv.MixValue(FORMAT_VERSION);
+    fnv.MixValue(IMGUI_VERSION_NUM);
+    fnv.MixValue(atlas->TexDesiredFormat);
+    fnv.MixValue(atlas->FontLoaderFlags);
+    if (atlas->FontLoaderName) {
+        fnv.Mix(atlas->FontLoaderName, strlen(atlas->FontLoaderName));
+    }
+
+    fnv.MixValue(atlas->Fonts.Size);
+    for (ImFont* font : atlas->Fonts) {
+        fnv.MixValue(font->Sources.Size);
+
+        for (ImFontConfig* src : font->Sources) {
+            const size_t dataSize = static_cast<size_t>(src->FontDataSize);
+            const unsigned char* data = static_cast<const unsigned char*>(src->FontData);
+            fnv.MixValue(dataSize);
+            if (data) {
+                fnv.MixContent(data, dataSize);
+            }
+
+            fnv.Mix(src->Name, strnlen(src->Name, sizeof(src->Name)));
+            fnv.MixValue(src->MergeMode);
+            fnv.MixValue(src->PixelSnapH);
+            fnv.MixValue(src->OversampleH);
+            fnv.MixValue(src->OversampleV);
+            fnv.MixValue(src->SizePixels);
+            fnv.MixValue(src->GlyphOffset);
+            fnv.MixValue(src->GlyphMinAdvanceX);
+            fnv.MixValue(src->GlyphMaxAdvanceX);
+            fnv.MixValue(src->GlyphExtraAdvanceX);
+            fnv.MixValue(src->FontNo);
+            fnv.MixValue(src->FontLoaderFlags);
+            fnv.MixValue(src->RasterizerMultiply);
+            fnv.MixValue(src->RasterizerDensity);
+            fnv.MixValue(src->EllipsisChar);
+            fnv.MixRanges(src->GlyphRanges);
+            fnv.MixRanges(src->GlyphExcludeRanges);
+        }
+    }
+    return fnv.hash;
+}
+
+fs::path GetDirectory()
+{
+    return ArchiveCache::GetDirectory() / "fonts";
+}
+
+fs::path EntryPath(uint64_t key)
+{
+    return GetDirectory() / std::format("{:016x}.glyphs", key);
+}
+
+size_t CountGlyphs(ImFontAtlas* atlas)
+{
+    if (!atlas->Builder) {
+        return 0;
+    }
+
+    size_t count = 0;
+    for (int i = 0; i < atlas->Builder->BakedPool.Size; i++) {
+        const ImFontBaked& baked = atlas->Builder->BakedPool[i];
+        if (!baked.WantDestroy) {
+            count += static_cast<size_t>(baked.Glyphs.Size);
+        }
+    }
+    return count;
+}
+
+/** Bounds checked reader over the mapped file */
+struct Reader
+{
+    const unsigned char* cursor;
+    const unsigned char* end;
+
+    template <typename T> bool Read(T& out)
+    {
+        if (static_cast<size_t>(end - cursor) < sizeof(T)) {
+            return false;
+        }
+        memcpy(&out, cursor, sizeof(T));
+        cursor += sizeof(T);
+        return true;
+    }
+
+    bool Skip(size_t size)
+    {
+        if (static_cast<size_t>(end - cursor) < size) {
+            return false;
+        }
+        cursor += size;
+        return true;
+    }
+};
+
+/** Walk the whole file once before touching the atlas, so a truncated or corrupt entry is rejected as a unit. */
+bool Validate(ImFontAtlas* atlas, Reader reader, uint32_t bakedCount, uint32_t bytesPerPixel)
+{
+    for (uint32_t i = 0; i < bakedCount; i++) {
+        BakedRecord baked;
+        if (!reader.Read(baked) || baked.fontIndex >= static_cast<uint32_t>(atlas->Fonts.Size) || !(baked.size > 0.0f) || !(baked.density > 0.0f)) {
+            return false;
+        }
+
+        const ImFont* font = atlas->Fonts[static_cast<int>(baked.fontIndex)];
+        for (uint32_t j = 0; j < baked.glyphCount; j++) {
+            GlyphRecord glyph;
+            if (!reader.Read(glyph) || glyph.codepoint > IM_UNICODE_CODEPOINT_MAX || glyph.sourceIndex >= font->Sources.Size) {
+                return false;
+            }
+            if (glyph.width > MAX_GLYPH_EXTENT || glyph.height > MAX_GLYPH_EXTENT) {
+                return false;
+            }
+            if (!reader.Skip(PaddedSize(static_cast<size_t>(glyph.width) * glyph.height * bytesPerPixel))) {
+                return false;
+            }
+        }
+    }
+    return reader.cursor == reader.end;
+}
+
+/** Keep the most recently used entries, e.g. one per scale factor the window has been shown at. */
+void EvictStaleEntries()
+{
+    std::error_code ec;
+    std::vector<std::pair<fs::file_time_type, fs::path>> entries;
+
+    for (const auto& item : fs::directory_iterator(GetDirectory(), ec)) {
+        if (item.is_regular_file(ec) && item.path().extension() == ".glyphs") {
+            entries.emplace_back(item.last_write_time(ec), item.path());
+        }
+    }
+
+    if (entries.size() <= FontCache::MAX_ENTRIES) {
+        return;
+    }
+
+    std::sort(entries.begin(), entries.end(), [](const auto& a, const auto& b) { return a.first > b.first; });
+    for (size_t i = FontCache::MAX_ENTRIES; i < entries.size(); i++) {
+        fs::remove(entries[i].second, ec);
+    }
+}
+} // namespace
+
+size_t FontCache::Load(ImFontAtlas* atlas)
+{
+    TRACE_SCOPE("FontCache::Load", "fonts");
+
+    s_key = ComputeKey(atlas);
+    s_savedGlyphs = 0;
+    s_lastGlyphCount = 0;
+
+    std::error_code ec;
+    const fs::path entry = EntryPath(s_key);
+    if (!fs::is_regular_file(entry, ec)) {
+        std::cout << "[fonts] No glyph cache for " << entry.filename().string() << std::endl;
+        return 0;
+    }
+
+    MappedFile file;
+    if (!file.open(entry)) {
+        return 0;
+    }
+
+    const unsigned char* data = static_cast<const unsigned char*>(file.data());
+    Reader reader{ data, data + file.size() };
+
+    FileHeader header;
+    if (!reader.Read(header) || header.magic != FILE_MAGIC || header.version != FORMAT_VERSION || header.key != s_key) {
+        std::cerr << "[fonts] Ignoring mismatched glyph cache " << entry.string() << std::endl;
+        return 0;
+    }
+
+    /** The atlas is normally built by the first NewFrame(); build it now so glyphs can be packed into it */
+    if (!atlas->Builder) {
+        ImFontAtlasBuildMain(atlas);
+    }
+
+    if (!atlas->TexData || static_cast<uint32_t>(atlas->TexData->BytesPerPixel) != header.bytesPerPixel || !Validate(atlas, reader, header.bakedCount, header.bytesPerPixel)) {
+        std::cerr << "[fonts] Discarding corrupt glyph cache " << entry.string() << std::endl;
+        file.close();
+        fs::remove(entry, ec);
+        return 0;
+    }
+
+    size_t restored = 0;
+    bool atlasFull = false;
+
+    for (uint32_t i = 0; i < header.bakedCount && !atlasFull; i++) {
+        BakedRecord record;
+        reader.Read(record);
+
+        ImFont* font = atlas->Fonts[static_cast<int>(record.fontIndex)];
+        ImFontBaked* baked = ImFontAtlasBakedGetOrAdd(atlas, font, record.size, record.density);
+
+        for (uint32_t j = 0; j < record.glyphCount; j++) {
+            GlyphRecord cached;
+            reader.Read(cached);
+
+            const size_t pixelBytes = static_cast<size_t>(cached.width) * cached.height * header.bytesPerPixel;
+            const unsigned char* pixels = reader.cursor;
+            reader.Skip(PaddedSize(pixelBytes));
+
+            /** Blank glyphs (space, tab) are set up whenever a baked size is created */
+            if (atlasFull || baked->IsGlyphLoaded(static_cast<ImWchar>(cached.codepoint))) {
+                continue;
+            }
+
+            ImFontGlyph glyph;
+            glyph.Codepoint = cached.codepoint;
+            glyph.Colored = cached.colored;
+            glyph.Visible = cached.visible;
+            glyph.SourceIdx = cached.sourceIndex;
+            glyph.AdvanceX = cached.advanceX;
+            glyph.X0 = cached.x0;
+            glyph.Y0 = cached.y0;
+            glyph.X1 = cached.x1;
+            glyph.Y1 = cached.y1;
+
+            if (pixelBytes > 0) {
+                const ImFontAtlasRectId packId = ImFontAtlasPackAddRect(atlas, cached.width, cached.height);
+                if (packId == ImFontAtlasRectId_Invalid) {
+                    atlasFull = true;
+                    continue;
+                }
+
+                /** Packing may have grown the texture, so only look it up afterwards */
+                ImTextureData* tex = atlas->TexData;
+                ImTextureRect* rect = ImFontAtlasPackGetRect(atlas, packId);
+                ImFontAtlasTextureBlockConvert(pixels, tex->Format, cached.width * tex->BytesPerPixel, static_cast<unsigned char*>(tex->GetPixelsAt(rect->x, rect->y)), tex->Format,
+                                               tex->GetPitch(), rect->w, rect->h);
+                ImFontAtlasTextureBlockQueueUpload(atlas, tex, rect->x, rect->y, rect->w, rect->h);
+                glyph.PackId = packId;
+            }
+
+            /** No source: metrics were final when saved, so skip advance clamping and extra spacing */
+            ImFontAtlasBakedAddFontGlyph(atlas, baked, nullptr, &glyph);
+            restored++;
+        }
+    }
+
+    /** The modification time doubles as the LRU timestamp */
+    fs::last_write_time(entry, fs::file_time_type::clock::now(), ec);
+
+    s_savedGlyphs = CountGlyphs(atlas);
+    s_lastGlyphCount = s_savedGlyphs;
+
+    std::cout << "[fonts] Restored " << restored << " glyphs from " << entry.filename().string() << (atlasFull ? " (atlas full)" : "") << std::endl;
+    return restored;
+}
+
+bool FontCache::Save(ImFontAtlas* atlas)
+{
+    TRACE_SCOPE("FontCache::Save", "fonts");
+
+    ImFontAtlasBuilder* builder = atlas->Builder;
+    ImTextureData* tex = atlas->TexData;
+    if (!builder || !tex || !tex->Pixels) {
+        return false;
+    }
+
+    if (s_key == 0) {
+        s_key = ComputeKey(atlas);
+    } else if (CountGlyphs(atlas) == s_savedGlyphs) {
+        return true;
+    }
+
+    const size_t bytesPerPixel = static_cast<size_t>(tex->BytesPerPixel);
+    std::vector<unsigned char> buffer;
+    auto append = [&buffer](const void* data, size_t size)
+    {
+        const unsigned char* bytes = static_cast<const unsigned char*>(data);
+        buffer.insert(buffer.end(), bytes, bytes + size);
+    };
+
+    FileHeader header{ FILE_MAGIC, FORMAT_VERSION, s_key, 0, static_cast<uint32_t>(bytesPerPixel) };
+    append(&header, sizeof(header));
+
+    size_t glyphCount = 0;
+    for (int i = 0; i < builder->BakedPool.Size; i++) {
+        const ImFontBaked& baked = builder->BakedPool[i];
+        const int fontIndex = atlas->Fonts.find_index(baked.OwnerFont);
+        if (baked.WantDestroy || fontIndex < 0 || baked.Glyphs.Size == 0) {
+            continue;
+        }
+
+        BakedRecord record{ static_cast<uint32_t>(fontIndex), baked.Size, baked.RasterizerDensity, static_cast<uint32_t>(baked.Glyphs.Size) };
+        append(&record, sizeof(record));
+        header.bakedCount++;
+
+        for (const ImFontGlyph& glyph : baked.Glyphs) {
+            const ImTextureRect* rect = glyph.PackId != ImFontAtlasRectId_Invalid ? ImFontAtlasPackGetRect(atlas, glyph.PackId) : nullptr;
+
+            GlyphRecord cached{};
+            cached.codepoint = glyph.Codepoint;
+            cached.width = rect ? rect->w : 0;
+            cached.height = rect ? rect->h : 0;
+            cached.colored = glyph.Colored;
+            cached.visible = glyph.Visible;
+            cached.sourceIndex = glyph.SourceIdx;
+            cached.advanceX = glyph.AdvanceX;
+            cached.x0 = glyph.X0;
+            cached.y0 = glyph.Y0;
+            cached.x1 = glyph.X1;
+            cached.y1 = glyph.Y1;
+            append(&cached, sizeof(cached));
+
+            if (rect) {
+                const size_t rowBytes = rect->w * bytesPerPixel;
+                for (int y = 0; y < rect->h; y++) {
+                    append(tex->GetPixelsAt(rect->x, rect->y + y), rowBytes);
+                }
+                buffer.resize(PaddedSize(buffer.size()), 0);
+            }
+            glyphCount++;
+        }
+    }
+    memcpy(buffer.data(), &header, sizeof(header));
+
+    std::error_code ec;
+    fs::create_directories(GetDirectory(), ec);
+
+    /** Written to a side file and renamed into place, a concurrent launch only ever maps a complete entry */
+    const fs::path entry = EntryPath(s_key);
+    const fs::path partial = entry.string() + ".partial";
+    {
+        std::ofstream out(partial, std::ios::binary | std::ios::trunc);
+        out.write(reinterpret_cast<const char*>(buffer.data()), static_cast<std::streamsize>(buffer.size()));
+        if (!out) {
+            std::cerr << "[fonts] Failed to write " << partial.string() << std::endl;
+            fs::remove(partial, ec);
+            return false;
+        }
+    }
+
+    fs::rename(partial, entry, ec);
+    if (ec) {
+        std::cerr << "[fonts] Failed to store glyph cache: " << ec.message() << std::endl;
+        fs::remove(partial, ec);
+        return false;
+    }
+
+    s_savedGlyphs = glyphCount;
+    EvictStaleEntries();
+
+    std::cout << "[fonts] Saved " << glyphCount << " glyphs (" << buffer.size() << " bytes) to " << entry.filename().string() << std::endl;
+    return true;
+}
+
+void FontCache::Update(ImFontAtlas* atlas)
+{
+    const size_t glyphCount = CountGlyphs(atlas);
+    const auto now = std::chrono::steady_clock::now();
+
+    if (glyphCount != s_lastGlyphCount) {
+        s_lastGlyphCount = glyphCount;
+        s_lastChange = now;
+    }
+
+    if (glyphCount == s_savedGlyphs) {
+        return;
+    }
+
+    if (std::chrono::duration<double>(now - s_lastChange).count() < SAVE_DELAY) {
+        /** Keep frames coming until the save is due, the UI may otherwise go idle first */
+        FrameScheduler::KeepAlive(SAVE_DELAY);
+        return;
+    }
+
+    /** Don't retry every frame when the cache directory isn't writable */
+    Save(atlas);
+    s_savedGlyphs = glyphCount;
+}
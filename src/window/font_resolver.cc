@@ -0,0 +1,203 @@
+/**
+ * ==================================================
+ *   _____ _ _ _             _
+ *  |     |_| | |___ ___ ___|_|_ _ _____
+ *  | | | | | | | -_|   |   | | | |     |
+ *  |_|_|_|_|_|_|___|_|_|_|_|_|___|_|_|_|
+ *
+ * ==================================================
+ *
+ * Copyright (c) 2025 Project Millennium
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <font_resolver.h>
+#include <trace.h>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+#include <mutex>
+#include <unordered_map>
+#ifdef HAVE_FONTCONFIG
+#include <fontconfig/fontconfig.h>
+#endif
+
+#ifndef _WIN32
+namespace
+{
+enum class Query
+{
+    Match,
+    List,
+};
+
+std::mutex s_mutex;
+std::unordered_map<std::string, std::string> s_resolved;
+
+bool UseCommandLineTools()
+{
+#ifdef HAVE_FONTCONFIG
+    static const bool forced = []
+    {
+        const char* value = std::getenv("MILLENNIUM_FONT_RESOLVER");
+        return value && strcmp(value, "popen") == 0;
+    }();
+    return forced;
+#else
+    return true;
+#endif
+}
+
+/** fc-match always returns something; these are the fallbacks it picks when nothing really covers the language */
+bool IsLatinFallback(const std::string& path)
+{
+    return path.find("DejaVu") != std::string::npos || path.find("LiberationSans") != std::string::npos || path.find("FreeSans") != std::string::npos;
+}
+
+std::string TrimLine(const char* line)
+{
+    std::string path(line);
+    while (!path.empty() && (path.back() == '\n' || path.back() == '\r' || path.back() == ' '))
+        path.pop_back();
+    return path;
+}
+
+std::string ResolveWithCommandLineTools(Query query, const std::string& langTag)
+{
+    const std::string cmd = query == Query::Match ? "fc-match --format='%{file}' ':lang=" + langTag + "' 2>/dev/null"
+                                                  : "fc-list ':lang=" + langTag + "' --format='%{file}\\n' 2>/dev/null";
+    FILE* pipe = popen(cmd.c_str(), "r");
+    if (!pipe)
+        return {};
+
+    std::string result;
+    char buf[1024] = {};
+    while (fgets(buf, sizeof(buf), pipe)) {
+        std::string path = TrimLine(buf);
+        if (query == Query::Match) {
+            result = path;
+            break;
+        }
+        if (!path.empty() && std::filesystem::exists(path)) {
+            result = path;
+            break;
+        }
+    }
+    pclose(pipe);
+    return result;
+}
+
+#ifdef HAVE_FONTCONFIG
+std::string ResolveWithFontconfig(Query query, const std::string& langTag)
+{
+    static const bool initialized = FcInit();
+    if (!initialized)
+        return {};
+
+    /** Same pattern syntax the command line tools take */
+    const std::string spec = ":lang=" + langTag;
+    FcPattern* pattern = FcNameParse(reinterpret_cast<const FcChar8*>(spec.c_str()));
+    if (!pattern)
+        return {};
+
+    std::string result;
+    if (query == Query::Match) {
+        FcConfigSubstitute(nullptr, pattern, FcMatchPattern);
+        FcDefaultSubstitute(pattern);
+
+        FcResult status;
+        if (FcPattern* match = FcFontMatch(nullptr, pattern, &status)) {
+            FcChar8* file = nullptr;
+            if (FcPatternGetString(match, FC_FILE, 0, &file) == FcResultMatch && file)
+                result = reinterpret_cast<const char*>(file);
+            FcPatternDestroy(match);
+        }
+    } else {
+        FcObjectSet* objects = FcObjectSetBuild(FC_FILE, nullptr);
+        if (FcFontSet* fonts = FcFontList(nullptr, pattern, objects)) {
+            for (int i = 0; i < fonts->nfont && result.empty(); i++) {
+                FcChar8* file = nullptr;
+                if (FcPatternGetString(fonts->fonts[i], FC_FILE, 0, &file) == FcResultMatch && file && std::filesystem::exists(reinterpret_cast<const char*>(file)))
+                    result = reinterpret_cast<const char*>(file);
+            }
+            FcFontSetDestroy(fonts);
+        }
+        FcObjectSetDestroy(objects);
+    }
+
+    FcPatternDestroy(pattern);
+    return result;
+}
+#endif
+
+std::string Resolve(Query query, const std::string& langTag)
+{
+    const std::string key = (query == Query::Match ? "match:" : "list:") + langTag;
+
+    /** Lookups are rare and the first one for a tag is the expensive part, so holding the lock across it is fine */
+    std::lock_guard<std::mutex> lock(s_mutex);
+    if (auto it = s_resolved.find(key); it != s_resolved.end())
+        return it->second;
+
+    TRACE_SCOPE("FontResolver::Resolve", "fonts", key);
+    const auto start = std::chrono::steady_clock::now();
+
+    const bool useTools = UseCommandLineTools();
+    std::string path;
+#ifdef HAVE_FONTCONFIG
+    path = useTools ? ResolveWithCommandLineTools(query, langTag) : ResolveWithFontconfig(query, langTag);
+#else
+    path = ResolveWithCommandLineTools(query, langTag);
+#endif
+
+    if (query == Query::Match && (IsLatinFallback(path) || !std::filesystem::exists(path)))
+        path.clear();
+
+    const double elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    std::cout << "[fonts] Resolved " << key << " to '" << path << "' in " << elapsed << "ms (" << (useTools ? "popen" : "fontconfig") << ")" << std::endl;
+
+    s_resolved.emplace(key, path);
+    return path;
+}
+} // namespace
+
+std::string FontResolver::Match(const std::string& langTag)
+{
+    return Resolve(Query::Match, langTag);
+}
+
+std::string FontResolver::ListFirst(const std::string& langTag)
+{
+    return Resolve(Query::List, langTag);
+}
+#else
+std::string FontResolver::Match(const std::string&)
+{
+    return {};
+}
+
+std::string FontResolver::ListFirst(const std::string&)
+{
+    return {};
+}
+#endif
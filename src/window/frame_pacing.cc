@@ -0,0 +1,174 @@
+/**
+ * ==================================================
+ *   _____ _ _ _             _
+ *  |     |_| | |___ ___ ___|_|_ _ _____
+ *  | | | | | | | -_|   |   | | | |     |
+ *  |_|_|_|_|_|_|___|_|_|_|_|_|___|_|_|_|
+ *
+ * ==================================================
+ *
+ * Copyright (c) 2025 Project Millennium
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <frame_pacing.h>
+#include <GLFW/glfw3.h>
+#include <trace.h>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <thread>
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+namespace
+{
+using Clock = std::chrono::steady_clock;
+using Seconds = std::chrono::duration<double>;
+
+constexpr int FALLBACK_REFRESH_RATE = 60;
+constexpr int MAX_REFRESH_RATE = 240;
+
+/** Frames used to decide whether vsync is honoured */
+constexpr int CALIBRATION_FRAMES = 20;
+
+std::atomic<int> refreshRate{ FALLBACK_REFRESH_RATE };
+
+bool vsyncRequested = false;
+bool vsyncActive = false;
+std::array<double, CALIBRATION_FRAMES> calibrationSamples{};
+int calibrationFrame = CALIBRATION_FRAMES;
+
+/** Learned OS oversleep; the timer sleeps until deadline - spinMargin and spins the rest */
+double spinMargin = 0.002;
+
+Clock::time_point frameStart;
+
+#ifdef _WIN32
+/** High resolution waitable timers (Windows 10 1803+) give sub-millisecond sleeps without timeBeginPeriod */
+HANDLE waitableTimer = nullptr;
+#endif
+
+double TargetFrameTime()
+{
+    return 1.0 / static_cast<double>(std::clamp(refreshRate.load(std::memory_order_relaxed), 1, MAX_REFRESH_RATE));
+}
+
+void SleepFor(double seconds)
+{
+#ifdef _WIN32
+    if (waitableTimer) {
+        LARGE_INTEGER dueTime;
+        dueTime.QuadPart = -static_cast<LONGLONG>(seconds * 10'000'000.0); // relative, in 100ns units
+        if (SetWaitableTimerEx(waitableTimer, &dueTime, 0, nullptr, nullptr, nullptr, 0)) {
+            WaitForSingleObject(waitableTimer, INFINITE);
+            return;
+        }
+    }
+#endif
+    std::this_thread::sleep_for(Seconds(seconds));
+}
+
+/** Sleep for the bulk of the wait, then spin the final slice the OS can't be trusted with. */
+void WaitUntil(Clock::time_point deadline)
+{
+    while (true) {
+        const double remaining = Seconds(deadline - Clock::now()).count();
+        if (remaining <= 0.0) {
+            return;
+        }
+
+        if (remaining > spinMargin) {
+            const double requested = remaining - spinMargin;
+            const auto sleepStart = Clock::now();
+            SleepFor(requested);
+
+            /** Track oversleep: grow quickly, decay slowly, so a single late wake doesn't make every frame late */
+            const double overslept = Seconds(Clock::now() - sleepStart).count() - requested;
+            spinMargin = overslept > spinMargin ? std::min(overslept * 1.25, 0.004) : spinMargin * 0.99 + std::max(overslept, 0.0) * 0.01;
+            spinMargin = std::max(spinMargin, 0.0002);
+            continue;
+        }
+
+        std::this_thread::yield();
+    }
+}
+} // namespace
+
+void FramePacing::SetRefreshRate(int hz)
+{
+    if (hz <= 0) {
+        hz = FALLBACK_REFRESH_RATE;
+    }
+
+    if (refreshRate.exchange(hz, std::memory_order_relaxed) != hz) {
+        std::cout << "[pacing] display refresh rate " << hz << " Hz" << std::endl;
+    }
+}
+
+void FramePacing::Initialize(GLFWwindow*)
+{
+#ifdef _WIN32
+    waitableTimer = CreateWaitableTimerExW(nullptr, nullptr, CREATE_WAITABLE_TIMER_HIGH_RESOLUTION, TIMER_ALL_ACCESS);
+    if (!waitableTimer) {
+        waitableTimer = CreateWaitableTimerExW(nullptr, nullptr, 0, TIMER_ALL_ACCESS);
+    }
+#endif
+
+    glfwSwapInterval(1);
+    vsyncRequested = true;
+    vsyncActive = false;
+    calibrationFrame = 0;
+}
+
+void FramePacing::BeginFrame()
+{
+    frameStart = Clock::now();
+}
+
+void FramePacing::EndFrame()
+{
+    const double target = TargetFrameTime();
+    const double workTime = Seconds(Clock::now() - frameStart).count();
+
+    /**
+     * Unpaced calibration frames: with vsync honoured, swaps alone take about one refresh period.
+     * The median ignores the first frames, which also pay for shader compilation and texture uploads.
+     */
+    if (calibrationFrame < CALIBRATION_FRAMES) {
+        calibrationSamples[calibrationFrame++] = workTime;
+
+        if (calibrationFrame == CALIBRATION_FRAMES) {
+            std::nth_element(calibrationSamples.begin(), calibrationSamples.begin() + CALIBRATION_FRAMES / 2, calibrationSamples.end());
+            const double median = calibrationSamples[CALIBRATION_FRAMES / 2];
+            vsyncActive = vsyncRequested && median >= target * 0.75;
+
+            std::cout << "[pacing] " << (vsyncActive ? "vsync is active" : "vsync is not honoured, using the frame timer") << " (median frame " << median * 1000.0
+                      << "ms, target " << target * 1000.0 << "ms)" << std::endl;
+        }
+    } else if (!vsyncActive) {
+        WaitUntil(frameStart + std::chrono::duration_cast<Clock::duration>(Seconds(target)));
+    }
+
+    Trace::Counter("frameTime", Seconds(Clock::now() - frameStart).count() * 1000.0);
+}
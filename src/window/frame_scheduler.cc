@@ -0,0 +1,100 @@
+/**
+ * ==================================================
+ *   _____ _ _ _             _
+ *  |     |_| | |___ ___ ___|_|_ _ _____
+ *  | | | | | | | -_|   |   | | | |     |
+ *  |_|_|_|_|_|_|___|_|_|_|_|_|___|_|_|_|
+ *
+ * ==================================================
+ *
+ * Copyright (c) 2025 Project Millennium
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <frame_scheduler.h>
+#include <trace.h>
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+
+namespace
+{
+using Clock = std::chrono::steady_clock;
+
+/** ImGui needs a couple of frames to resolve hover/active state after an event, one more to draw the result */
+constexpr int SETTLE_FRAMES = 3;
+
+/** Long enough for ImGui's hover delays and every input-triggered transition in the UI */
+constexpr double INPUT_GRACE_SECONDS = 1.0;
+
+std::mutex frameMutex;
+std::condition_variable frameCondition;
+
+/** Start with a few frames pending so the window gets its first paint before it's shown */
+int pendingFrames = SETTLE_FRAMES;
+Clock::time_point keepAliveUntil = Clock::time_point::min();
+} // namespace
+
+void FrameScheduler::RequestFrame()
+{
+    {
+        std::lock_guard<std::mutex> lock(frameMutex);
+        pendingFrames = std::max(pendingFrames, SETTLE_FRAMES);
+    }
+    frameCondition.notify_one();
+}
+
+void FrameScheduler::KeepAlive(double seconds)
+{
+    const auto deadline = Clock::now() + std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(seconds));
+    {
+        std::lock_guard<std::mutex> lock(frameMutex);
+        keepAliveUntil = std::max(keepAliveUntil, deadline);
+        pendingFrames = std::max(pendingFrames, 1);
+    }
+    frameCondition.notify_one();
+}
+
+void FrameScheduler::NotifyInput()
+{
+    KeepAlive(INPUT_GRACE_SECONDS);
+    RequestFrame();
+}
+
+void FrameScheduler::WaitForFrame()
+{
+    std::unique_lock<std::mutex> lock(frameMutex);
+
+    if (pendingFrames > 0) {
+        pendingFrames--;
+        return;
+    }
+    if (Clock::now() < keepAliveUntil) {
+        return;
+    }
+
+    TRACE_SCOPE("FrameScheduler::Idle", "render");
+    frameCondition.wait(lock, [] { return pendingFrames > 0 || Clock::now() < keepAliveUntil; });
+
+    if (pendingFrames > 0) {
+        pendingFrames--;
+    }
+}
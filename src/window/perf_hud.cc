@@ -0,0 +1,310 @@
+/**
+ * ==================================================
+ *   _____ _ _ _             _
+ *  |     |_| | |___ ___ ___|_|_ _ _____
+ *  | | | | | | | -_|   |   | | | |     |
+ *  |_|_|_|_|_|_|___|_|_|_|_|_|___|_|_|_|
+ *
+ * ==================================================
+ *
+ * Copyright (c) 2025 Project Millennium
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <GL/glew.h>
+#include <perf_hud.h>
+#include <alloc_counter.h>
+#include <animate.h>
+#include <frame_scheduler.h>
+#include <dpi.h>
+#include <imgui.h>
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+
+namespace
+{
+using Clock = std::chrono::steady_clock;
+
+/** Timer results arrive a frame or two late; with this many queries in flight reading one never stalls the pipeline */
+constexpr size_t QUERY_SLOTS = 4;
+
+struct FrameStats
+{
+    unsigned long long frame;
+    double cpuMs;
+    double gpuMs; // negative when timer queries aren't available
+    int vertices;
+    int indices;
+    size_t allocations;
+    size_t allocatedBytes;
+    size_t animations;
+};
+
+struct QuerySlot
+{
+    GLuint query = 0;
+    bool pending = false;
+    FrameStats stats{};
+};
+
+bool s_visible = false;
+FILE* s_csv = nullptr;
+unsigned long long s_frameLimit = 0;
+unsigned long long s_frameCount = 0;
+
+bool s_glReady = false;
+bool s_timerQueries = false;
+bool s_firstQueryResolved = false;
+std::array<QuerySlot, QUERY_SLOTS> s_slots;
+size_t s_nextSlot = 0;
+
+bool s_frameActive = false;
+bool s_gpuActive = false;
+Clock::time_point s_frameStart;
+AllocCounter::Totals s_allocationsAtStart{};
+
+FrameStats s_last{};
+bool s_hasLast = false;
+
+bool IsMeasuring()
+{
+    return s_visible || s_csv || s_frameLimit;
+}
+
+/** Frames are published in the order they were drawn: shown on the overlay and appended to the CSV. */
+void Publish(const FrameStats& stats)
+{
+    s_last = stats;
+    s_hasLast = true;
+
+    if (s_csv) {
+        fprintf(s_csv, "%llu,%.4f,", stats.frame, stats.cpuMs);
+        if (stats.gpuMs >= 0.0) {
+            fprintf(s_csv, "%.4f", stats.gpuMs);
+        }
+        fprintf(s_csv, ",%d,%d,%zu,%zu,%zu\n", stats.vertices, stats.indices, stats.allocations, stats.allocatedBytes, stats.animations);
+    }
+}
+
+/** Publish the slot's frame once its GPU time is known. Returns false if it's still in flight and `wait` is false. */
+bool ResolveSlot(QuerySlot& slot, bool wait)
+{
+    if (!slot.pending) {
+        return true;
+    }
+
+    if (!wait) {
+        GLint available = 0;
+        glGetQueryObjectiv(slot.query, GL_QUERY_RESULT_AVAILABLE, &available);
+        if (!available) {
+            return false;
+        }
+    }
+
+    GLuint64 elapsed = 0;
+    glGetQueryObjectui64v(slot.query, GL_QUERY_RESULT, &elapsed);
+    slot.pending = false;
+
+    /** llvmpipe reports a timestamp rather than a duration for the very first query, so that frame goes without */
+    slot.stats.gpuMs = s_firstQueryResolved ? static_cast<double>(elapsed) / 1e6 : -1.0;
+    s_firstQueryResolved = true;
+    Publish(slot.stats);
+    return true;
+}
+
+/** Oldest first, stopping at the first query still in flight so frames stay in order. */
+void ResolveSlots(bool wait)
+{
+    for (size_t i = 0; i < QUERY_SLOTS; i++) {
+        if (!ResolveSlot(s_slots[(s_nextSlot + i) % QUERY_SLOTS], wait)) {
+            break;
+        }
+    }
+}
+
+void EnsureQueries()
+{
+    if (s_glReady) {
+        return;
+    }
+    s_glReady = true;
+
+    /** Core in GL 3.3; the installer asks for a 3.0 context, where it's an extension every desktop driver and llvmpipe expose */
+    s_timerQueries = GLEW_VERSION_3_3 || GLEW_ARB_timer_query;
+    if (!s_timerQueries) {
+        std::cout << "[perf] GL timer queries unavailable, GPU time will not be reported" << std::endl;
+        return;
+    }
+    for (QuerySlot& slot : s_slots) {
+        glGenQueries(1, &slot.query);
+    }
+}
+
+void DrawOverlay()
+{
+    char gpu[32] = "n/a";
+    if (s_hasLast && s_last.gpuMs >= 0.0) {
+        snprintf(gpu, sizeof(gpu), "%.2f ms", s_last.gpuMs);
+    }
+
+    char text[256];
+    if (s_hasLast) {
+        snprintf(text, sizeof(text), "CPU %.2f ms   GPU %s\nVertices %d   Indices %d\nAllocations %zu (%zu B)\nAnimations %zu", s_last.cpuMs, gpu,
+                 s_last.vertices, s_last.indices, s_last.allocations, s_last.allocatedBytes, s_last.animations);
+    } else {
+        snprintf(text, sizeof(text), "Measuring...");
+    }
+
+    const ImGuiViewport* viewport = ImGui::GetMainViewport();
+    const ImVec2 padding(ScaleX(6), ScaleY(6));
+    const ImVec2 pos(viewport->Pos.x + ScaleX(10), viewport->Pos.y + ScaleY(80));
+    const ImVec2 textSize = ImGui::CalcTextSize(text);
+
+    ImDrawList* drawList = ImGui::GetForegroundDrawList();
+    drawList->AddRectFilled(pos, ImVec2(pos.x + textSize.x + padding.x * 2, pos.y + textSize.y + padding.y * 2), IM_COL32(0, 0, 0, 190), ScaleX(4));
+    drawList->AddText(ImVec2(pos.x + padding.x, pos.y + padding.y), IM_COL32(255, 255, 255, 255), text);
+}
+} // namespace
+
+void PerfHud::Initialize(int argc, char** argv)
+{
+    if (const char* env = std::getenv("MILLENNIUM_PERF_HUD"); env && *env && std::strcmp(env, "0") != 0) {
+        s_visible = true;
+    }
+
+    for (int i = 1; i < argc; i++) {
+        const std::string arg = argv[i];
+        if (arg.rfind("--perf-csv=", 0) == 0 && arg.size() > 11) {
+            const std::string path = arg.substr(11);
+            s_csv = fopen(path.c_str(), "w");
+            if (!s_csv) {
+                std::cerr << "[perf] Failed to open " << path << std::endl;
+                continue;
+            }
+            fprintf(s_csv, "frame,cpu_ms,gpu_ms,vertices,indices,allocations,allocated_bytes,animations\n");
+        } else if (arg.rfind("--perf-frames=", 0) == 0) {
+            s_frameLimit = std::strtoull(arg.c_str() + 14, nullptr, 10);
+        }
+    }
+}
+
+void PerfHud::BeginFrame()
+{
+    if (!IsMeasuring()) {
+        return;
+    }
+
+    EnsureQueries();
+    if (s_timerQueries) {
+        ResolveSlots(false);
+    }
+
+    s_frameActive = true;
+    s_frameStart = Clock::now();
+    s_allocationsAtStart = AllocCounter::ThisThread();
+}
+
+void PerfHud::Render()
+{
+    if (ImGui::IsKeyPressed(ImGuiKey_F3, false)) {
+        s_visible = !s_visible;
+    }
+
+    if (s_visible) {
+        DrawOverlay();
+    }
+}
+
+void PerfHud::BeginGpuWork()
+{
+    if (!s_frameActive || !s_timerQueries) {
+        return;
+    }
+
+    /** Only waits if the GPU is more than QUERY_SLOTS frames behind */
+    QuerySlot& slot = s_slots[s_nextSlot];
+    ResolveSlot(slot, true);
+
+    glBeginQuery(GL_TIME_ELAPSED, slot.query);
+    s_gpuActive = true;
+}
+
+void PerfHud::EndFrame(const ImDrawData* drawData)
+{
+    if (!s_frameActive) {
+        return;
+    }
+    s_frameActive = false;
+
+    const AllocCounter::Totals allocations = AllocCounter::ThisThread();
+
+    FrameStats stats{};
+    stats.frame = s_frameCount++;
+    stats.cpuMs = std::chrono::duration<double, std::milli>(Clock::now() - s_frameStart).count();
+    stats.gpuMs = -1.0;
+    stats.vertices = drawData ? drawData->TotalVtxCount : 0;
+    stats.indices = drawData ? drawData->TotalIdxCount : 0;
+    stats.allocations = allocations.allocations - s_allocationsAtStart.allocations;
+    stats.allocatedBytes = allocations.bytes - s_allocationsAtStart.bytes;
+    stats.animations = ActiveAnimationCount();
+
+    if (s_gpuActive) {
+        glEndQuery(GL_TIME_ELAPSED);
+        s_gpuActive = false;
+
+        QuerySlot& slot = s_slots[s_nextSlot];
+        slot.stats = stats;
+        slot.pending = true;
+        s_nextSlot = (s_nextSlot + 1) % QUERY_SLOTS;
+    } else {
+        Publish(stats);
+    }
+
+    /** A timed run measures back-to-back frames rather than whenever the UI happens to change */
+    if (s_frameLimit) {
+        FrameScheduler::RequestFrame();
+    }
+}
+
+bool PerfHud::IsFinished()
+{
+    return s_frameLimit && s_frameCount >= s_frameLimit;
+}
+
+void PerfHud::Shutdown()
+{
+    if (s_timerQueries) {
+        ResolveSlots(true);
+        for (QuerySlot& slot : s_slots) {
+            glDeleteQueries(1, &slot.query);
+        }
+        s_timerQueries = false;
+    }
+
+    if (s_csv) {
+        fclose(s_csv);
+        s_csv = nullptr;
+    }
+}
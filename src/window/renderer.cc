@@ -32,6 +32,7 @@
 #include <GLFW/glfw3.h>
 #include <renderer.h>
 #include <imgui.h>
+#include <imgui_internal.h>
 #include <imgui_impl_glfw.h>
 #include <imgui_impl_opengl3.h>
 #include <misc/freetype/imgui_freetype.h>
@@ -43,9 +44,21 @@
 #include <i18n.h>
 #include <cjk_names.h>
 #include <viet_name.h>
-#include <memory.h>
+#include <assets.h>
+#include <trace.h>
+#include <startup_profile.h>
+#include <animate.h>
+#include <frame_scheduler.h>
+#include <frame_pacing.h>
+#include <font_cache.h>
+#include <font_resolver.h>
+#include <worker.h>
+#include <ui_events.h>
+#include <text_layout.h>
+#include <perf_hud.h>
 #include <filesystem>
 #include <atomic>
+#include <optional>
 #include <iostream>
 #include <format>
 #include <thread>
@@ -58,12 +71,27 @@ using namespace ImGui;
 int WINDOW_WIDTH = 663;
 int WINDOW_HEIGHT = 434;
 
-static const float TARGET_FPS = 240.0f;
-static const float TARGET_FRAME_TIME = 1.0f / TARGET_FPS;
+/** Frames resume after arbitrarily long idle periods; don't let that gap skip every animation to its end */
+static const float MAX_FRAME_DELTA = 1.0f / 30.0f;
 
 static std::atomic<bool> shouldSetupScaling{ false };
 static GLFWwindow* g_Window = nullptr;
 
+/** Everything a font build reads, captured on the renderer thread so the build never races the UI changing it */
+struct FontBuildRequest
+{
+    float scaleFactor;
+    /** Density ImGui will bake at, i.e. the framebuffer scale */
+    float rasterizerDensity;
+    std::string language;
+    bool usesCJK;
+};
+
+/** Font atlases are rebuilt off the renderer thread; the finished atlas is handed back through s_builtAtlas */
+static BackgroundWorker s_fontWorker;
+static std::atomic<ImFontAtlas*> s_builtAtlas{ nullptr };
+static float s_pendingFontScale = 1.0f;
+
 void GLFWErrorCallback(int error, const char* description)
 {
 #ifdef _WIN32
@@ -96,22 +124,63 @@ void FrameBufferSizeCallback(GLFWwindow* window, int width, int height)
     shouldSetupScaling.store(true, std::memory_order_relaxed);
 }
 
+/**
+ * Re-pace frames to whichever monitor now holds the centre of the window.
+ * @note Runs on the main thread, where GLFW allows monitor queries.
+ */
+void WindowPosCallback(GLFWwindow* window, int x, int y)
+{
+    int width, height;
+    glfwGetWindowSize(window, &width, &height);
+    const int centerX = x + width / 2;
+    const int centerY = y + height / 2;
+
+    int monitorCount = 0;
+    GLFWmonitor** monitors = glfwGetMonitors(&monitorCount);
+
+    for (int i = 0; i < monitorCount; i++) {
+        const GLFWvidmode* mode = glfwGetVideoMode(monitors[i]);
+        if (!mode) {
+            continue;
+        }
+
+        int monitorX, monitorY;
+        glfwGetMonitorPos(monitors[i], &monitorX, &monitorY);
+
+        if (centerX >= monitorX && centerX < monitorX + mode->width && centerY >= monitorY && centerY < monitorY + mode->height) {
+            FramePacing::SetRefreshRate(mode->refreshRate);
+            return;
+        }
+    }
+}
+
 void RequestFontRebuild()
 {
     shouldSetupScaling.store(true, std::memory_order_relaxed);
+    FrameScheduler::RequestFrame();
 }
 
-void SetupImGuiScaling(GLFWwindow* window)
+/**
+ * Build a complete, detached font atlas for the given scale and language.
+ * @note Runs on the font worker. It only touches the atlas it creates, so the renderer keeps drawing with the current one meanwhile.
+ */
+static ImFontAtlas* BuildFontAtlas(const FontBuildRequest& request)
 {
-    SetupDPI(window);
+    TRACE_SCOPE("BuildFontAtlas", "fonts", request.language);
 
-    ImGuiIO& io = GetIO();
-    ImGuiStyle& style = GetStyle();
-    float scaleFactor = XDPI;
+    const float scaleFactor = request.scaleFactor;
+    ImFontAtlas* atlas = IM_NEW(ImFontAtlas)();
+
+    /** Set before any font is added, so each source is initialized by FreeType once instead of being re-created */
+    atlas->SetFontLoader(ImGuiFreeType::GetFontLoader());
 
     ImFontConfig mem_cfg;
     mem_cfg.FontDataOwnedByAtlas = false;
 
+    /** Inflated from the embedded assets on first use, here on the font worker; the data stays valid for the process */
+    const std::span<const unsigned char> geistRegular = Assets::Get(Assets::Id::GeistVariable);
+    const std::span<const unsigned char> geistBold = Assets::Get(Assets::Id::GeistBold);
+
 #ifdef _WIN32
     constexpr static const auto fontPath = "C:/Windows/Fonts/seguiemj.ttf";
     static ImFontConfig cfg;
@@ -157,60 +226,18 @@ void SetupImGuiScaling(GLFWwindow* window)
     };
 
 #if !defined(_WIN32)
-    // Ask fontconfig for the best Latin font for a given language tag.
-    // Returns empty string if fc-match is not installed or returns a poor fallback.
-    auto fcMatch = [](const char* langTag) -> std::string
-    {
-        std::string cmd = std::string("fc-match --format='%{file}' ':lang=") + langTag + "' 2>/dev/null";
-        FILE* pipe = popen(cmd.c_str(), "r");
-        if (!pipe)
-            return {};
-        char buf[1024] = {};
-        if (!fgets(buf, sizeof(buf), pipe)) {
-            pclose(pipe);
-            return {};
-        }
-        pclose(pipe);
-        std::string path(buf);
-        while (!path.empty() && (path.back() == '\n' || path.back() == '\r' || path.back() == ' '))
-            path.pop_back();
-        if (path.find("DejaVu") != std::string::npos)
-            return {};
-        if (path.find("LiberationSans") != std::string::npos)
-            return {};
-        if (path.find("FreeSans") != std::string::npos)
-            return {};
-        return std::filesystem::exists(path) ? path : std::string{};
-    };
-
-    // Use fc-list instead of fc-match for CJK: fc-list only returns fonts that
-    // genuinely declare coverage for the language, while fc-match always returns
-    // something (often a Latin fallback like Inter) even with no CJK fonts installed.
-    auto fcListFirst = [](const char* langTag) -> std::string
-    {
-        std::string cmd = std::string("fc-list ':lang=") + langTag + "' --format='%{file}\\n' 2>/dev/null";
-        FILE* pipe = popen(cmd.c_str(), "r");
-        if (!pipe)
-            return {};
-        char buf[1024] = {};
-        while (fgets(buf, sizeof(buf), pipe)) {
-            std::string path(buf);
-            while (!path.empty() && (path.back() == '\n' || path.back() == '\r' || path.back() == ' '))
-                path.pop_back();
-            if (!path.empty() && std::filesystem::exists(path)) {
-                pclose(pipe);
-                return path;
-            }
-        }
-        pclose(pipe);
-        return {};
-    };
+    // fontconfig queries are answered in-process and memoized per language tag,
+    // see FontResolver. fc-list style lookups are used for CJK: they only return
+    // fonts that genuinely declare coverage for the language, while fc-match
+    // always returns something (often a Latin fallback like Inter).
+    auto fcMatch = [](const char* langTag) -> std::string { return FontResolver::Match(langTag); };
+    auto fcListFirst = [](const char* langTag) -> std::string { return FontResolver::ListFirst(langTag); };
 #endif
 
     const std::string cjkSystemFont = [&]() -> std::string
     {
-        const std::string& lang = Locale::GetCurrentLanguageId();
-        if (!Locale::UsesCJK())
+        const std::string& lang = request.language;
+        if (!request.usesCJK)
             return {};
 
 #if defined(_WIN32)
@@ -263,7 +290,7 @@ void SetupImGuiScaling(GLFWwindow* window)
     //              it keeps looking the same as English mode.
     const std::string vietSystemFont = [&]() -> std::string
     {
-        if (Locale::GetCurrentLanguageId() != "vietnamese")
+        if (request.language != "vietnamese")
             return {};
 #if defined(_WIN32)
         return findFont({ "C:/Windows/Fonts/arial.ttf" });
@@ -293,7 +320,7 @@ void SetupImGuiScaling(GLFWwindow* window)
 
     const std::string vietSystemFontBold = [&]() -> std::string
     {
-        if (Locale::GetCurrentLanguageId() != "vietnamese")
+        if (request.language != "vietnamese")
             return {};
 #if defined(_WIN32)
         return findFont({ "C:/Windows/Fonts/arialbd.ttf" });
@@ -326,41 +353,51 @@ void SetupImGuiScaling(GLFWwindow* window)
     viet_preview_cfg.MergeMode = true;
     viet_preview_cfg.FontDataOwnedByAtlas = false;
 
-    io.Fonts->Clear();
+    /** System CJK fonts run to tens of MB; read the file once and share it between both sizes. The last source added owns it. */
+    void* cjkFontData = nullptr;
+    size_t cjkFontSize = 0;
+#ifndef CJK_FONTS_UNAVAILABLE
+    if (!cjkSystemFont.empty() && !isVietnamese) {
+        cjkFontData = ImFileLoadToMemory(cjkSystemFont.c_str(), "rb", &cjkFontSize);
+    }
+#endif
+    ImFontConfig cjk_system_cfg = cjk_name_cfg;
 
     /** Fonts[0] – UI regular: Arial when Vietnamese, Geist otherwise */
     if (isVietnamese) {
-        io.Fonts->AddFontFromFileTTF(vietSystemFont.c_str(), 16.0f * scaleFactor, nullptr);
+        atlas->AddFontFromFileTTF(vietSystemFont.c_str(), 16.0f * scaleFactor, nullptr);
     } else {
-        io.Fonts->AddFontFromMemoryTTF((void*)GeistVariable, sizeof(GeistVariable), 16.0f * scaleFactor, &mem_cfg);
+        atlas->AddFontFromMemoryTTF((void*)geistRegular.data(), (int)geistRegular.size(), 16.0f * scaleFactor, &mem_cfg);
 #ifndef CJK_FONTS_UNAVAILABLE
-        io.Fonts->AddFontFromMemoryTTF((void*)CJKNames_Ideographs, sizeof(CJKNames_Ideographs), 16.0f * scaleFactor, &cjk_name_cfg, cjk_ideograph_ranges);
-        io.Fonts->AddFontFromMemoryTTF((void*)CJKNames_Korean, sizeof(CJKNames_Korean), 16.0f * scaleFactor, &cjk_name_cfg, cjk_hangul_ranges);
-        if (!cjkSystemFont.empty())
-            io.Fonts->AddFontFromFileTTF(cjkSystemFont.c_str(), 16.0f * scaleFactor, &cjk_name_cfg, cjk_full_ranges);
+        atlas->AddFontFromMemoryTTF((void*)CJKNames_Ideographs, sizeof(CJKNames_Ideographs), 16.0f * scaleFactor, &cjk_name_cfg, cjk_ideograph_ranges);
+        atlas->AddFontFromMemoryTTF((void*)CJKNames_Korean, sizeof(CJKNames_Korean), 16.0f * scaleFactor, &cjk_name_cfg, cjk_hangul_ranges);
+        if (cjkFontData)
+            atlas->AddFontFromMemoryTTF(cjkFontData, static_cast<int>(cjkFontSize), 16.0f * scaleFactor, &cjk_system_cfg, cjk_full_ranges);
 #endif
     }
 #ifdef _WIN32
     if (std::filesystem::exists(fontPath))
-        io.Fonts->AddFontFromFileTTF(fontPath, 14.0f * scaleFactor, &cfg);
+        atlas->AddFontFromFileTTF(fontPath, 14.0f * scaleFactor, &cfg);
 #endif
 
     /** Fonts[1] – UI bold: Arial Bold when Vietnamese, Geist Bold otherwise */
     if (isVietnamese) {
         const std::string& boldSrc = vietSystemFontBold.empty() ? vietSystemFont : vietSystemFontBold;
-        io.Fonts->AddFontFromFileTTF(boldSrc.c_str(), 18.0f * scaleFactor, nullptr);
+        atlas->AddFontFromFileTTF(boldSrc.c_str(), 18.0f * scaleFactor, nullptr);
     } else {
-        io.Fonts->AddFontFromMemoryTTF((void*)Geist_Bold, sizeof(Geist_Bold), 18.0f * scaleFactor, &mem_cfg);
+        atlas->AddFontFromMemoryTTF((void*)geistBold.data(), (int)geistBold.size(), 18.0f * scaleFactor, &mem_cfg);
 #ifndef CJK_FONTS_UNAVAILABLE
-        io.Fonts->AddFontFromMemoryTTF((void*)CJKNames_Ideographs, sizeof(CJKNames_Ideographs), 18.0f * scaleFactor, &cjk_name_cfg, cjk_ideograph_ranges);
-        io.Fonts->AddFontFromMemoryTTF((void*)CJKNames_Korean, sizeof(CJKNames_Korean), 18.0f * scaleFactor, &cjk_name_cfg, cjk_hangul_ranges);
-        if (!cjkSystemFont.empty())
-            io.Fonts->AddFontFromFileTTF(cjkSystemFont.c_str(), 18.0f * scaleFactor, &cjk_name_cfg, cjk_full_ranges);
+        atlas->AddFontFromMemoryTTF((void*)CJKNames_Ideographs, sizeof(CJKNames_Ideographs), 18.0f * scaleFactor, &cjk_name_cfg, cjk_ideograph_ranges);
+        atlas->AddFontFromMemoryTTF((void*)CJKNames_Korean, sizeof(CJKNames_Korean), 18.0f * scaleFactor, &cjk_name_cfg, cjk_hangul_ranges);
+        if (cjkFontData) {
+            cjk_system_cfg.FontDataOwnedByAtlas = true;
+            atlas->AddFontFromMemoryTTF(cjkFontData, static_cast<int>(cjkFontSize), 18.0f * scaleFactor, &cjk_system_cfg, cjk_full_ranges);
+        }
 #endif
     }
 #ifdef _WIN32
     if (std::filesystem::exists(fontPath))
-        io.Fonts->AddFontFromFileTTF(fontPath, 14.0f * scaleFactor, &cfg);
+        atlas->AddFontFromFileTTF(fontPath, 14.0f * scaleFactor, &cfg);
 #endif
 
     /** Fonts[2] – VietName_Standalone: Arial covering every glyph in "Tieng Viet".
@@ -368,22 +405,77 @@ void SetupImGuiScaling(GLFWwindow* window)
      *  from one typeface with no Geist mixing. */
     ImFontConfig viet_sa_cfg;
     viet_sa_cfg.FontDataOwnedByAtlas = false;
-    io.Fonts->AddFontFromMemoryTTF((void*)VietName_Standalone, sizeof(VietName_Standalone), 16.0f * scaleFactor, &viet_sa_cfg);
+    atlas->AddFontFromMemoryTTF((void*)VietName_Standalone, sizeof(VietName_Standalone), 16.0f * scaleFactor, &viet_sa_cfg);
 
     /** Fonts[3] – Geist + VietName preview glyphs (ế, ệ) + CJK names.
      *  Added only when Vietnamese is active. The dropdown pushes this font around
      *  the entire combo so it looks identical to English mode. */
     if (isVietnamese) {
-        io.Fonts->AddFontFromMemoryTTF((void*)GeistVariable, sizeof(GeistVariable), 16.0f * scaleFactor, &mem_cfg);
-        io.Fonts->AddFontFromMemoryTTF((void*)VietName_Standalone, sizeof(VietName_Standalone), 16.0f * scaleFactor, &viet_preview_cfg, viet_preview_ranges);
+        atlas->AddFontFromMemoryTTF((void*)geistRegular.data(), (int)geistRegular.size(), 16.0f * scaleFactor, &mem_cfg);
+        atlas->AddFontFromMemoryTTF((void*)VietName_Standalone, sizeof(VietName_Standalone), 16.0f * scaleFactor, &viet_preview_cfg, viet_preview_ranges);
 #ifndef CJK_FONTS_UNAVAILABLE
-        io.Fonts->AddFontFromMemoryTTF((void*)CJKNames_Ideographs, sizeof(CJKNames_Ideographs), 16.0f * scaleFactor, &cjk_name_cfg, cjk_ideograph_ranges);
-        io.Fonts->AddFontFromMemoryTTF((void*)CJKNames_Korean, sizeof(CJKNames_Korean), 16.0f * scaleFactor, &cjk_name_cfg, cjk_hangul_ranges);
+        atlas->AddFontFromMemoryTTF((void*)CJKNames_Ideographs, sizeof(CJKNames_Ideographs), 16.0f * scaleFactor, &cjk_name_cfg, cjk_ideograph_ranges);
+        atlas->AddFontFromMemoryTTF((void*)CJKNames_Korean, sizeof(CJKNames_Korean), 16.0f * scaleFactor, &cjk_name_cfg, cjk_hangul_ranges);
 #endif
     }
 
-    /** Explicitly set FreeType as the font loader to ensure color emoji support */
-    io.Fonts->SetFontLoader(ImGuiFreeType::GetFontLoader());
+    /**
+     * Glyphs otherwise rasterize on the renderer thread the first time they are drawn, which for a CJK language is hundreds
+     * of them on the first frame after a switch. Bake exactly what the translations use here instead; anything else, such
+     * as paths or release notes, still loads on demand from the full ranges above.
+     */
+    {
+        TRACE_SCOPE("PrebakeLocaleGlyphs", "fonts", request.language);
+        const std::vector<char32_t> codepoints = Locale::GetCodepoints(request.language);
+
+        for (int i = 0; i < std::min(atlas->Fonts.Size, 2); i++) {
+            ImFont* font = atlas->Fonts[i];
+            ImFontBaked* baked = ImFontAtlasBakedGetOrAdd(atlas, font, font->LegacySize, request.rasterizerDensity);
+            for (char32_t codepoint : codepoints) {
+                if (codepoint <= IM_UNICODE_CODEPOINT_MAX)
+                    baked->FindGlyph(static_cast<ImWchar>(codepoint));
+            }
+        }
+        std::cout << "[fonts] Prebaked " << codepoints.size() << " codepoints for " << request.language << std::endl;
+    }
+
+    return atlas;
+}
+
+/**
+ * Make a freshly built atlas the context's font atlas and rescale the style to match.
+ * @note Renderer thread only, between frames. The old atlas' GL textures are released here; the new atlas
+ * is uploaded by the backend on the next frame, and its glyph cache restored by the caller.
+ */
+static void InstallFontAtlas(ImFontAtlas* atlas, float scaleFactor)
+{
+    TRACE_SCOPE("InstallFontAtlas", "fonts");
+
+    ImGuiIO& io = GetIO();
+    ImGuiStyle& style = GetStyle();
+    ImFontAtlas* previous = io.Fonts;
+
+    /** Keep whatever the old fonts baked for next time */
+    FontCache::Save(previous);
+
+    UnregisterFontAtlas(previous);
+    if (io.BackendRendererUserData) {
+        for (ImTextureData* tex : previous->TexList) {
+            if (tex->TexID != ImTextureID_Invalid) {
+                tex->SetStatus(ImTextureStatus_WantDestroy);
+                tex->UnusedFrames = 1;
+                ImGui_ImplOpenGL3_UpdateTexture(tex);
+            }
+        }
+    }
+    IM_DELETE(previous);
+
+    atlas->OwnerContext = GetCurrentContext();
+    io.Fonts = atlas;
+    RegisterFontAtlas(atlas);
+
+    /** Cached sizes and line breaks were measured with the fonts that were just freed */
+    TextLayout::Invalidate();
 
     io.DisplayFramebufferScale = ImVec2(scaleFactor, scaleFactor);
 
@@ -393,6 +485,51 @@ void SetupImGuiScaling(GLFWwindow* window)
     SetupColorScheme();
 }
 
+static FontBuildRequest CaptureFontBuildRequest(float scaleFactor)
+{
+    const ImGuiViewport* viewport = GetMainViewport();
+    const float density = viewport->FramebufferScale.x != 0.0f ? viewport->FramebufferScale.x : GetIO().DisplayFramebufferScale.x;
+    return { scaleFactor, density, Locale::GetCurrentLanguageId(), Locale::UsesCJK() };
+}
+
+void SetupImGuiScaling(GLFWwindow* window)
+{
+    SetupDPI(window);
+    InstallFontAtlas(BuildFontAtlas(CaptureFontBuildRequest(XDPI)), XDPI);
+}
+
+/** Renderer thread: start building fonts for the current scale and language in the background. */
+static void BeginFontRebuild(GLFWwindow* window)
+{
+    SetupDPI(window);
+
+    /** A finished atlas that hasn't been installed yet was built for the scale this request replaces */
+    if (ImFontAtlas* superseded = s_builtAtlas.exchange(nullptr, std::memory_order_acq_rel)) {
+        IM_DELETE(superseded);
+    }
+    s_pendingFontScale = XDPI;
+
+    const FontBuildRequest request = CaptureFontBuildRequest(XDPI);
+    s_fontWorker.run([request]()
+    {
+        if (ImFontAtlas* unclaimed = s_builtAtlas.exchange(BuildFontAtlas(request), std::memory_order_acq_rel)) {
+            IM_DELETE(unclaimed);
+        }
+    });
+}
+
+/** Renderer thread: swap in the atlas the font worker finished, if any. */
+static void InstallBuiltFontAtlas()
+{
+    ImFontAtlas* atlas = s_builtAtlas.exchange(nullptr, std::memory_order_acq_rel);
+    if (!atlas) {
+        return;
+    }
+
+    InstallFontAtlas(atlas, s_pendingFontScale);
+    FontCache::Load(atlas);
+}
+
 static bool s_windowFocused = true;
 
 bool IsWindowFocused()
@@ -402,59 +539,110 @@ bool IsWindowFocused()
 
 void SpawnRendererThread(GLFWwindow* window, const char* glsl_version, std::shared_ptr<RouterNav> router)
 {
+    Trace::SetThreadName("renderer");
     glfwSetWindowFocusCallback(window, [](GLFWwindow*, int focused) { s_windowFocused = (focused != 0); });
     glfwMakeContextCurrent(window);
 #ifndef _WIN32
     glewExperimental = GL_TRUE;
 #endif
-    if (glewInit() != GLEW_OK) {
-        std::cerr << "Failed to initialize GLEW\n";
-        return;
+    {
+        STARTUP_PHASE("glewInit");
+        if (glewInit() != GLEW_OK) {
+            std::cerr << "Failed to initialize GLEW\n";
+            return;
+        }
     }
 
-    SetupColorScheme();
-    SetupImGuiScaling(window);
+    {
+        STARTUP_PHASE("SetupColorScheme");
+        SetupColorScheme();
+    }
+    {
+        STARTUP_PHASE("SetupImGuiScaling");
+        SetupImGuiScaling(window);
+    }
     SetBorderlessWindowStyle(window, router);
-    LoadTextures();
-    ImGui_ImplGlfw_InitForOpenGL(window, true);
-    ImGui_ImplOpenGL3_Init(glsl_version);
+    {
+        STARTUP_PHASE("LoadTextures");
+        LoadTextures();
+    }
+    {
+        STARTUP_PHASE("ImGui backend init");
+        ImGui_ImplGlfw_InitForOpenGL(window, true);
+        ImGui_ImplOpenGL3_Init(glsl_version);
+    }
+    {
+        STARTUP_PHASE("FontCache::Load");
+        FontCache::Load(GetIO().Fonts);
+    }
+    FramePacing::Initialize(window);
 
     while (!glfwWindowShouldClose(window)) {
-        double frameStartTime = glfwGetTime();
-
-        if (shouldSetupScaling.load(std::memory_order_relaxed)) {
-            SetupImGuiScaling(window);
-            shouldSetupScaling.store(false, std::memory_order_relaxed);
+        /** Sleeps here while nothing on screen is changing */
+        FrameScheduler::WaitForFrame();
+        if (glfwWindowShouldClose(window)) {
+            break;
         }
 
-        RenderImGui(window, router);
+        FramePacing::BeginFrame();
+
+        /** Keep drawing with the current fonts until the worker hands over the rebuilt atlas */
+        InstallBuiltFontAtlas();
+        if (!s_fontWorker.busy() && shouldSetupScaling.exchange(false, std::memory_order_relaxed)) {
+            BeginFontRebuild(window);
+        }
 
         static bool hasShown = false;
+        {
+            /** The first frame uploads the font atlas, so it counts towards startup */
+            std::optional<StartupProfile::Phase> firstFrame;
+            if (!hasShown) {
+                firstFrame.emplace("First frame");
+            }
+            RenderImGui(window, router);
+        }
+        FontCache::Update(GetIO().Fonts);
 
         if (!hasShown) {
             glfwShowWindow(window);
             hasShown = true;
-        }
+            StartupProfile::FirstFrameShown();
 
-        double elapsedTime = glfwGetTime() - frameStartTime;
-        double remainingTime = TARGET_FRAME_TIME - elapsedTime;
+            if (StartupProfile::IsBenchmark()) {
+                glfwSetWindowShouldClose(window, GLFW_TRUE);
+                glfwPostEmptyEvent();
+            }
+        }
 
-        if (remainingTime > 0) {
-#ifdef _WIN32
-            Sleep((DWORD)(remainingTime * 1000));
-#else
-            std::this_thread::sleep_for(std::chrono::duration<double>(remainingTime));
-#endif
+        if (PerfHud::IsFinished()) {
+            glfwSetWindowShouldClose(window, GLFW_TRUE);
+            glfwPostEmptyEvent();
         }
+
+        /** Waits out the rest of the refresh period when vsync didn't already */
+        FramePacing::EndFrame();
     }
+
+    PerfHud::Shutdown();
+
+    /** A rebuild finishing during shutdown is never installed */
+    s_fontWorker.join();
+    if (ImFontAtlas* atlas = s_builtAtlas.exchange(nullptr)) {
+        IM_DELETE(atlas);
+    }
+
+    FontCache::Save(GetIO().Fonts);
 }
 
-void RenderImGui(GLFWwindow* window, std::shared_ptr<RouterNav> router)
+void BuildFrame(std::shared_ptr<RouterNav> router)
 {
-    ImGui_ImplOpenGL3_NewFrame();
-    ImGui_ImplGlfw_NewFrame();
+    ImGuiIO& io = GetIO();
+    io.DeltaTime = std::min(io.DeltaTime, MAX_FRAME_DELTA);
     NewFrame();
 
+    /** Apply everything background threads posted since the last frame before any of it is drawn */
+    UiEvents::Drain();
+
     ImGuiViewport* viewport = GetMainViewport();
     {
         SetNextWindowPos(viewport->Pos);
@@ -466,20 +654,7 @@ void RenderImGui(GLFWwindow* window, std::shared_ptr<RouterNav> router)
 
         isTitleBarHovered = RenderTitleBarComponent(router);
         router->update();
-
-        auto currentPanel = router->getCurrentComponent();
-        auto transitioningPanel = router->getTransitioningComponent();
-        auto xOffsetCurrent = router->getCurrentOffset(viewport->Size.x);
-        auto xOffsetTransitioning = router->getTransitioningOffset(viewport->Size.x);
-
-        if (transitioningPanel) {
-            PushID("TransitioningPanel");
-            transitioningPanel(router, xOffsetTransitioning);
-            PopID();
-        }
-
-        SameLine();
-        currentPanel(router, xOffsetCurrent);
+        router->render(viewport->Size.x);
 
         if (IsKeyPressed(ImGuiKey_MouseX1)) {
             if (router->canGoBack())
@@ -487,10 +662,32 @@ void RenderImGui(GLFWwindow* window, std::shared_ptr<RouterNav> router)
         }
 
         End();
+        RenderUpdateNotice();
         RenderMessageBoxes();
+
+        if (AdvanceAnimations(io.DeltaTime)) {
+            FrameScheduler::RequestFrame();
+        }
+        PerfHud::Render();
     }
     Render();
 
+    /** Keep the text cursor blinking while an input box has focus */
+    if (io.WantTextInput) {
+        FrameScheduler::KeepAlive(0.5);
+    }
+}
+
+void RenderImGui(GLFWwindow* window, std::shared_ptr<RouterNav> router)
+{
+    PerfHud::BeginFrame();
+    ImGui_ImplOpenGL3_NewFrame();
+    ImGui_ImplGlfw_NewFrame();
+
+    BuildFrame(router);
+
+    PerfHud::BeginGpuWork();
+
     int display_w, display_h;
     glfwGetFramebufferSize(window, &display_w, &display_h);
     glViewport(0, 0, display_w, display_h);
@@ -501,5 +698,6 @@ void RenderImGui(GLFWwindow* window, std::shared_ptr<RouterNav> router)
     glClear(GL_COLOR_BUFFER_BIT);
 
     ImGui_ImplOpenGL3_RenderDrawData(GetDrawData());
+    PerfHud::EndFrame(GetDrawData());
     glfwSwapBuffers(window);
 }
@@ -0,0 +1,148 @@
+/**
+ * ==================================================
+ *   _____ _ _ _             _
+ *  |     |_| | |___ ___ ___|_|_ _ _____
+ *  | | | | | | | -_|   |   | | | |     |
+ *  |_|_|_|_|_|_|___|_|_|_|_|_|___|_|_|_|
+ *
+ * ==================================================
+ *
+ * Copyright (c) 2025 Project Millennium
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <text_layout.h>
+#include <imgui_internal.h>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+struct LayoutKey
+{
+    const char* text;
+    ImFont* font;
+    float fontSize;
+    float wrapWidth;
+
+    bool operator==(const LayoutKey& other) const = default;
+};
+
+struct LayoutKeyHash
+{
+    size_t operator()(const LayoutKey& key) const
+    {
+        size_t hash = std::hash<const void*>{}(key.text);
+        hash = hash * 31 + std::hash<const void*>{}(key.font);
+        hash = hash * 31 + std::hash<float>{}(key.fontSize);
+        hash = hash * 31 + std::hash<float>{}(key.wrapWidth);
+        return hash;
+    }
+};
+
+/** Byte range of one wrapped line, relative to the start of the text */
+struct LineRange
+{
+    uint32_t begin;
+    uint32_t end;
+};
+
+struct Layout
+{
+    ImVec2 size;
+    std::vector<LineRange> lines;
+};
+
+std::unordered_map<LayoutKey, Layout, LayoutKeyHash> s_layouts;
+
+/** Split `text` the way ImFont::RenderText() wraps it, so each line can be drawn without wrapping again. */
+std::vector<LineRange> BreakLines(ImFont* font, float fontSize, const char* text, const char* textEnd, float wrapWidth)
+{
+    std::vector<LineRange> lines;
+    const char* lineStart = text;
+
+    while (lineStart < textEnd) {
+        const char* newline = static_cast<const char*>(std::memchr(lineStart, '\n', textEnd - lineStart));
+        const char* lineEnd = ImFontCalcWordWrapPositionEx(font, fontSize, lineStart, newline ? newline : textEnd, wrapWidth);
+
+        lines.push_back({ static_cast<uint32_t>(lineStart - text), static_cast<uint32_t>(lineEnd - text) });
+        lineStart = ImTextCalcWordWrapNextLineStart(lineEnd, textEnd);
+    }
+    return lines;
+}
+} // namespace
+
+ImVec2 TextLayout::Measure(const char* text)
+{
+    const LayoutKey key{ text, ImGui::GetFont(), ImGui::GetFontSize(), 0.0f };
+
+    auto it = s_layouts.find(key);
+    if (it == s_layouts.end()) {
+        it = s_layouts.emplace(key, Layout{ ImGui::CalcTextSize(text), {} }).first;
+    }
+    return it->second.size;
+}
+
+void TextLayout::TextWrapped(const char* text)
+{
+    ImGuiWindow* window = ImGui::GetCurrentWindow();
+    if (window->SkipItems) {
+        return;
+    }
+
+    /** Wrap at the edge of the content region, like ImGui::TextWrapped() does without a wrap position pushed */
+    const float wrapPos = window->DC.TextWrapPos >= 0.0f ? window->DC.TextWrapPos : 0.0f;
+    const float wrapWidth = ImGui::CalcWrapWidthForPos(window->DC.CursorPos, wrapPos);
+
+    ImFont* font = ImGui::GetFont();
+    const float fontSize = ImGui::GetFontSize();
+    const LayoutKey key{ text, font, fontSize, wrapWidth };
+
+    auto it = s_layouts.find(key);
+    if (it == s_layouts.end()) {
+        const char* textEnd = text + std::strlen(text);
+        it = s_layouts.emplace(key, Layout{ ImGui::CalcTextSize(text, textEnd, false, wrapWidth), BreakLines(font, fontSize, text, textEnd, wrapWidth) }).first;
+    }
+    const Layout& layout = it->second;
+
+    const ImVec2 textPos(window->DC.CursorPos.x, window->DC.CursorPos.y + window->DC.CurrLineTextBaseOffset);
+    const ImRect bb(textPos, textPos + layout.size);
+    ImGui::ItemSize(layout.size, 0.0f);
+    if (!ImGui::ItemAdd(bb, 0)) {
+        return;
+    }
+
+    const ImU32 color = ImGui::GetColorU32(ImGuiCol_Text);
+    ImVec2 linePos = textPos;
+    for (const LineRange& line : layout.lines) {
+        if (line.end > line.begin) {
+            window->DrawList->AddText(font, fontSize, linePos, color, text + line.begin, text + line.end);
+        }
+        linePos.y += fontSize;
+    }
+}
+
+void TextLayout::Invalidate()
+{
+    s_layouts.clear();
+}
@@ -28,63 +28,40 @@
  * SOFTWARE.
  */
 
-#define STB_IMAGE_IMPLEMENTATION
-#include <stb_image.h>
-
 #include <texture.hh>
-#include <memory.h>
+#include <assets.h>
+#include <icon_atlas.h>
 #include <imgui.h>
+#include <iterator>
+
+static_assert(std::size(kIconAtlasRects) == (size_t)Icon::Count, "icon_atlas.h is out of sync with the Icon enum");
 
-GLuint logoTexture;
-GLuint infoIconTexture;
-GLuint closeButtonTexture;
-GLuint discordIconTexture;
-GLuint gtihubIconTexture;
-GLuint backBtnTexture;
-GLuint excludedIconTexture;
-GLuint errorIconTexture;
-GLuint successIconTexture;
-GLuint languageIconTexture;
+GLuint iconAtlasTexture;
+static ImVec2 s_iconAtlasSize;
 
-bool LoadTextureFromMemory(const void* data, size_t data_size, GLuint* out_texture, int* out_width, int* out_height)
+/**
+ * Upload the icon atlas. The pixels were decoded and packed by embed_assets at build time
+ * and are stored uncompressed, so startup only pays for a single texture upload.
+ */
+void LoadTextures()
 {
-    int image_width = 0;
-    int image_height = 0;
-    unsigned char* image_data = stbi_load_from_memory((const unsigned char*)data, (int)data_size, &image_width, &image_height, NULL, 4);
-    if (image_data == NULL) {
-        return false;
-    }
+    const Assets::Image atlas = Assets::GetImage(Assets::Id::IconAtlas);
+    s_iconAtlasSize = ImVec2((float)atlas.width, (float)atlas.height);
 
-    GLuint image_texture;
-    glGenTextures(1, &image_texture);
-    glBindTexture(GL_TEXTURE_2D, image_texture);
+    glGenTextures(1, &iconAtlasTexture);
+    glBindTexture(GL_TEXTURE_2D, iconAtlasTexture);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
     glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
-    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, image_width, image_height, 0, GL_RGBA, GL_UNSIGNED_BYTE, image_data);
-    stbi_image_free(image_data);
-
-    *out_texture = image_texture;
-    if (out_width) {
-        *out_width = image_width;
-    }
-
-    if (out_height) {
-        *out_height = image_height;
-    }
-    return true;
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, atlas.width, atlas.height, 0, GL_RGBA, GL_UNSIGNED_BYTE, atlas.pixels);
 }
 
-void LoadTextures()
+void DrawIcon(Icon icon, const ImVec2& size)
 {
-    LoadTextureFromMemory(logo, sizeof(logo), &logoTexture);
-    LoadTextureFromMemory(infoIcon, sizeof(infoIcon), &infoIconTexture);
-    LoadTextureFromMemory(closeBtn, sizeof(closeBtn), &closeButtonTexture);
-    LoadTextureFromMemory(discordIcon, sizeof(discordIcon), &discordIconTexture);
-    LoadTextureFromMemory(githubIcon, sizeof(githubIcon), &gtihubIconTexture);
-    LoadTextureFromMemory(backBtn, sizeof(backBtn), &backBtnTexture);
-    LoadTextureFromMemory(excludedIcon, sizeof(excludedIcon), &excludedIconTexture);
-    LoadTextureFromMemory(errorIcon, sizeof(errorIcon), &errorIconTexture);
-    LoadTextureFromMemory(successIcon, sizeof(successIcon), &successIconTexture);
-    LoadTextureFromMemory(languageIcon, sizeof(languageIcon), &languageIconTexture);
+    const int* rect = kIconAtlasRects[(size_t)icon];
+    const ImVec2 uv0((float)rect[0] / s_iconAtlasSize.x, (float)rect[1] / s_iconAtlasSize.y);
+    const ImVec2 uv1((float)(rect[0] + rect[2]) / s_iconAtlasSize.x, (float)(rect[1] + rect[3]) / s_iconAtlasSize.y);
+
+    ImGui::Image((ImTextureID)(intptr_t)iconAtlasTexture, size, uv0, uv1);
 }
@@ -32,8 +32,7 @@
 #include <renderer.h>
 #include <dpi.h>
 #include <util.h>
-#include <memory.h>
-#include <stb_image.h>
+#include <assets.h>
 
 bool isTitleBarHovered = false;
 
@@ -83,10 +82,6 @@ LRESULT CALLBACK WindowProc(HWND hWnd, UINT uMsg, WPARAM wParam, LPARAM lParam)
         {
             return true;
         }
-        case WM_DESTROY:
-        {
-            timeEndPeriod(1);
-        }
     }
 
     return CallWindowProc(g_OriginalWindProcCallback, hWnd, uMsg, wParam, lParam);
@@ -114,26 +109,22 @@ void SetBorderlessWindowStyle(GLFWwindow* window, std::shared_ptr<RouterNav> rou
 
 void SetWindowIcon(GLFWwindow* window)
 {
-    int width, height, channels;
     ColorScheme colorScheme = GetWindowsColorScheme();
 
-    static const std::map<ColorScheme, std::tuple<const unsigned char*, size_t>> iconMap = {
-        { ColorScheme::Light, { windowIconDark, sizeof(windowIconDark) }   },
-        { ColorScheme::Dark,  { windowIconLight, sizeof(windowIconLight) } },
+    static const std::map<ColorScheme, Assets::Id> iconMap = {
+        { ColorScheme::Light, Assets::Id::WindowIconDark  },
+        { ColorScheme::Dark,  Assets::Id::WindowIconLight },
     };
 
-    auto& icon = iconMap.at(colorScheme);
-    unsigned char* data = stbi_load_from_memory(std::get<0>(icon), std::get<1>(icon), &width, &height, &channels, 4);
-
-    if (!data)
+    const Assets::Image icon = Assets::GetImage(iconMap.at(colorScheme));
+    if (!icon.pixels)
         return;
 
     GLFWimage glfwIcon;
-    glfwIcon.pixels = data;
-    glfwIcon.width = width;
-    glfwIcon.height = height;
+    glfwIcon.pixels = const_cast<unsigned char*>(icon.pixels);
+    glfwIcon.width = icon.width;
+    glfwIcon.height = icon.height;
     glfwSetWindowIcon(window, 1, &glfwIcon);
-    stbi_image_free(data);
 }
 
 #else // !_WIN32
@@ -142,17 +133,15 @@ void SetBorderlessWindowStyle(GLFWwindow*, std::shared_ptr<RouterNav>) {}
 
 void SetWindowIcon(GLFWwindow* window)
 {
-    int width, height, channels;
-    unsigned char* data = stbi_load_from_memory(windowIconLight, sizeof(windowIconLight), &width, &height, &channels, 4);
-    if (!data)
+    const Assets::Image icon = Assets::GetImage(Assets::Id::WindowIconLight);
+    if (!icon.pixels)
         return;
 
     GLFWimage glfwIcon;
-    glfwIcon.pixels = data;
-    glfwIcon.width = width;
-    glfwIcon.height = height;
+    glfwIcon.pixels = const_cast<unsigned char*>(icon.pixels);
+    glfwIcon.width = icon.width;
+    glfwIcon.height = icon.height;
     glfwSetWindowIcon(window, 1, &glfwIcon);
-    stbi_image_free(data);
 }
 
 #endif // _WIN32
@@ -0,0 +1,171 @@
+/**
+ * ==================================================
+ *   _____ _ _ _             _
+ *  |     |_| | |___ ___ ___|_|_ _ _____
+ *  | | | | | | | -_|   |   | | | |     |
+ *  |_|_|_|_|_|_|___|_|_|_|_|_|___|_|_|_|
+ *
+ * ==================================================
+ *
+ * Copyright (c) 2025 Project Millennium
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * Per-frame heap allocation micro-benchmark for the installer's routes.
+ *
+ * Builds frames exactly like RenderImGui() does, minus the GL backend, and counts every operator new made while a route
+ * draws itself (see alloc_counter.h). After a warm-up (first-use allocations such as animation and widget state are expected), a static page
+ * should allocate nothing per frame.
+ *
+ *   bench_frame_allocs [--frames=N] [--warmup=N]
+ *
+ * Configure with -DINSTALLER_BUILD_BENCHMARKS=ON to build it.
+ */
+
+#include <imgui.h>
+#include <router.h>
+#include <renderer.h>
+#include <components.h>
+#include <animate.h>
+#include <i18n.h>
+#include <alloc_counter.h>
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace
+{
+struct FrameSample
+{
+    size_t allocations;
+    size_t bytes;
+};
+
+struct RouteBenchmark
+{
+    const char* name;
+    Component route;
+};
+
+/** Draw one frame of `route` the way RenderImGui() lays out the main window, and return what the route allocated. */
+FrameSample RenderFrame(const std::shared_ptr<RouterNav>& router, const Component& route)
+{
+    ImGui::NewFrame();
+
+    ImGuiViewport* viewport = ImGui::GetMainViewport();
+    ImGui::SetNextWindowPos(viewport->Pos);
+    ImGui::SetNextWindowSize(viewport->Size);
+
+    ImGui::PushStyleVar(ImGuiStyleVar_WindowPadding, ImVec2(0, 0));
+    ImGui::Begin("Millennium", nullptr, ImGuiWindowFlags_NoTitleBar | ImGuiWindowFlags_NoResize | ImGuiWindowFlags_NoScrollbar | ImGuiWindowFlags_NoScrollWithMouse);
+    ImGui::PopStyleVar();
+
+    const AllocCounter::Totals before = AllocCounter::ThisThread();
+
+    route(router, 0.f);
+
+    const AllocCounter::Totals after = AllocCounter::ThisThread();
+    const FrameSample sample = { after.allocations - before.allocations, after.bytes - before.bytes };
+
+    ImGui::End();
+    AdvanceAnimations(ImGui::GetIO().DeltaTime);
+    ImGui::Render();
+    return sample;
+}
+
+size_t ParseCount(const char* arg, const char* prefix, size_t fallback)
+{
+    const size_t length = std::strlen(prefix);
+    return std::strncmp(arg, prefix, length) == 0 ? std::strtoul(arg + length, nullptr, 10) : fallback;
+}
+} // namespace
+
+int main(int argc, char** argv)
+{
+    size_t frames = 240, warmup = 30;
+    for (int i = 1; i < argc; i++) {
+        frames = ParseCount(argv[i], "--frames=", frames);
+        warmup = ParseCount(argv[i], "--warmup=", warmup);
+    }
+    frames = std::max<size_t>(frames, 1);
+
+    IMGUI_CHECKVERSION();
+    ImGui::CreateContext();
+
+    ImGuiIO& io = ImGui::GetIO();
+    io.IniFilename = nullptr;
+    io.DisplaySize = ImVec2(static_cast<float>(WINDOW_WIDTH), static_cast<float>(WINDOW_HEIGHT));
+    io.DeltaTime = 1.0f / 60.0f;
+    /** No GL backend: the atlas is never uploaded, which ImGui allows once a renderer claims texture support */
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasTextures;
+
+    /** The routes index Fonts[0..3] (regular, bold, Vietnamese name, dropdown); glyph cost isn't what's measured */
+    for (int i = 0; i < 4; i++) {
+        io.Fonts->AddFontDefault();
+    }
+
+    Locale::Initialize();
+
+    /** Enough release state for the install prompt to draw its version and size lines */
+    selectedRelease = { { "tag_name", "v2.30.0" } };
+    osReleaseInfo = { { "name", "millennium-v2.30.0-linux-x86_64.tar.gz" }, { "size", 33554432 } };
+
+    const RouteBenchmark routes[] = {
+        { "RenderHome", RenderHome },
+        { "RenderInstallPrompt", RenderInstallPrompt },
+        { "RenderInstaller", RenderInstaller },
+    };
+
+    std::printf("[bench] %zu frames per route after %zu warm-up frames\n", frames, warmup);
+    std::printf("[bench] %-22s %12s %12s %12s %14s\n", "route", "min allocs", "median", "max", "median bytes");
+
+    for (const RouteBenchmark& benchmark : routes) {
+        auto router = std::make_shared<RouterNav>(std::vector<Component>{ benchmark.route });
+
+        for (size_t i = 0; i < warmup; i++) {
+            RenderFrame(router, benchmark.route);
+        }
+
+        std::vector<FrameSample> samples;
+        samples.reserve(frames);
+        for (size_t i = 0; i < frames; i++) {
+            samples.push_back(RenderFrame(router, benchmark.route));
+        }
+
+        std::vector<size_t> allocations, bytes;
+        allocations.reserve(frames);
+        bytes.reserve(frames);
+        for (const FrameSample& sample : samples) {
+            allocations.push_back(sample.allocations);
+            bytes.push_back(sample.bytes);
+        }
+        std::sort(allocations.begin(), allocations.end());
+        std::sort(bytes.begin(), bytes.end());
+
+        std::printf("[bench] %-22s %12zu %12zu %12zu %14zu\n", benchmark.name, allocations.front(), allocations[frames / 2], allocations.back(), bytes[frames / 2]);
+    }
+
+    ImGui::DestroyContext();
+    return 0;
+}
@@ -0,0 +1,301 @@
+/**
+ * ==================================================
+ *   _____ _ _ _             _
+ *  |     |_| | |___ ___ ___|_|_ _ _____
+ *  | | | | | | | -_|   |   | | | |     |
+ *  |_|_|_|_|_|_|___|_|_|_|_|_|___|_|_|_|
+ *
+ * ==================================================
+ *
+ * Copyright (c) 2025 Project Millennium
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * Headless frame-time benchmark for the installer's UI.
+ *
+ * Creates an offscreen OpenGL context through EGL's surfaceless platform (Mesa llvmpipe on machines without a GPU),
+ * then walks the router through home, install prompt, installer and uninstall the way a user would, sweeping the mouse
+ * across every page so hover animations run. Each frame is built with BuildFrame(), submitted with the OpenGL3 backend
+ * and finished with glFinish(), so the timings include rasterization. Buttons that would start a download or touch the
+ * Steam directory are never clicked; the walk moves between pages with the router instead.
+ *
+ *   LIBGL_ALWAYS_SOFTWARE=1 bench_render [--frames=N] [--warmup=N] [--scale=F]
+ *
+ * Linux only. Configure with -DINSTALLER_BUILD_BENCHMARKS=ON to build it.
+ */
+
+#include <GL/glew.h>
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+#include <imgui.h>
+#include <imgui_impl_opengl3.h>
+#include <router.h>
+#include <renderer.h>
+#include <components.h>
+#include <texture.hh>
+#include <dpi.h>
+#include <i18n.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+namespace
+{
+struct FrameSample
+{
+    double buildMs;
+    double totalMs;
+    int vertices;
+    int indices;
+    int commands;
+};
+
+struct Phase
+{
+    const char* name;
+    std::vector<FrameSample> samples;
+};
+
+struct OffscreenContext
+{
+    EGLDisplay display = EGL_NO_DISPLAY;
+    EGLContext context = EGL_NO_CONTEXT;
+    GLuint framebuffer = 0;
+    GLuint colorBuffer = 0;
+};
+
+bool CreateOffscreenContext(OffscreenContext& offscreen, int width, int height)
+{
+    const auto getPlatformDisplay = reinterpret_cast<PFNEGLGETPLATFORMDISPLAYEXTPROC>(eglGetProcAddress("eglGetPlatformDisplayEXT"));
+    if (!getPlatformDisplay) {
+        std::fprintf(stderr, "[bench] eglGetPlatformDisplayEXT is not available\n");
+        return false;
+    }
+
+    offscreen.display = getPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, nullptr);
+    if (offscreen.display == EGL_NO_DISPLAY || !eglInitialize(offscreen.display, nullptr, nullptr)) {
+        std::fprintf(stderr, "[bench] failed to initialize the surfaceless EGL display (0x%x)\n", eglGetError());
+        return false;
+    }
+
+    if (!eglBindAPI(EGL_OPENGL_API)) {
+        std::fprintf(stderr, "[bench] EGL has no desktop OpenGL support (0x%x)\n", eglGetError());
+        return false;
+    }
+
+    /** Same context the window asks GLFW for: GL 3.0, drawn with the "#version 130" shaders */
+    const EGLint contextAttributes[] = { EGL_CONTEXT_MAJOR_VERSION, 3, EGL_CONTEXT_MINOR_VERSION, 0, EGL_NONE };
+    offscreen.context = eglCreateContext(offscreen.display, EGL_NO_CONFIG_KHR, EGL_NO_CONTEXT, contextAttributes);
+    if (offscreen.context == EGL_NO_CONTEXT || !eglMakeCurrent(offscreen.display, EGL_NO_SURFACE, EGL_NO_SURFACE, offscreen.context)) {
+        std::fprintf(stderr, "[bench] failed to create an OpenGL 3.0 context (0x%x)\n", eglGetError());
+        return false;
+    }
+
+    /** A GLX build of GLEW can't find a GLX display here, but it has already loaded the context's entry points by then */
+    glewExperimental = GL_TRUE;
+    const GLenum glewStatus = glewInit();
+    if (glewStatus != GLEW_OK && glewStatus != GLEW_ERROR_NO_GLX_DISPLAY) {
+        std::fprintf(stderr, "[bench] glewInit failed: %s\n", reinterpret_cast<const char*>(glewGetErrorString(glewStatus)));
+        return false;
+    }
+
+    glGenFramebuffers(1, &offscreen.framebuffer);
+    glBindFramebuffer(GL_FRAMEBUFFER, offscreen.framebuffer);
+    glGenRenderbuffers(1, &offscreen.colorBuffer);
+    glBindRenderbuffer(GL_RENDERBUFFER, offscreen.colorBuffer);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, width, height);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, offscreen.colorBuffer);
+
+    if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
+        std::fprintf(stderr, "[bench] offscreen framebuffer is incomplete\n");
+        return false;
+    }
+
+    std::printf("[bench] %s, %s\n", reinterpret_cast<const char*>(glGetString(GL_RENDERER)), reinterpret_cast<const char*>(glGetString(GL_VERSION)));
+    return true;
+}
+
+void DestroyOffscreenContext(OffscreenContext& offscreen)
+{
+    glDeleteRenderbuffers(1, &offscreen.colorBuffer);
+    glDeleteFramebuffers(1, &offscreen.framebuffer);
+    eglMakeCurrent(offscreen.display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+    eglDestroyContext(offscreen.display, offscreen.context);
+    eglTerminate(offscreen.display);
+}
+
+double MillisecondsSince(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+/** Scripted input: a slow Lissajous sweep that crosses every button and card on the page without clicking */
+void MoveMouse(size_t frame, int width, int height)
+{
+    const float t = static_cast<float>(frame) / 60.0f;
+    const float x = (0.5f + 0.45f * std::sin(t * 1.3f)) * static_cast<float>(width);
+    const float y = (0.5f + 0.45f * std::sin(t * 2.1f + 0.7f)) * static_cast<float>(height);
+    ImGui::GetIO().AddMousePosEvent(x, y);
+}
+
+FrameSample RenderFrame(const std::shared_ptr<RouterNav>& router, size_t frame, int width, int height)
+{
+    const auto start = std::chrono::steady_clock::now();
+
+    ImGui_ImplOpenGL3_NewFrame();
+    ImGuiIO& io = ImGui::GetIO();
+    io.DisplaySize = ImVec2(static_cast<float>(width), static_cast<float>(height));
+    io.DeltaTime = 1.0f / 60.0f;
+    MoveMouse(frame, width, height);
+
+    BuildFrame(router);
+    const double buildMs = MillisecondsSince(start);
+
+    glViewport(0, 0, width, height);
+    glClearColor(0.f, 0.f, 0.f, 0.f);
+    glClear(GL_COLOR_BUFFER_BIT);
+
+    ImDrawData* drawData = ImGui::GetDrawData();
+    ImGui_ImplOpenGL3_RenderDrawData(drawData);
+    /** Software GL rasterizes lazily; wait for it so the frame is actually drawn inside the measurement */
+    glFinish();
+
+    int commands = 0;
+    for (const ImDrawList* list : drawData->CmdLists) {
+        commands += list->CmdBuffer.Size;
+    }
+    return { buildMs, MillisecondsSince(start), drawData->TotalVtxCount, drawData->TotalIdxCount, commands };
+}
+
+/** Navigate, let the slide animation and the page's own intro settle for `warmup` frames, then record `frames` frames */
+void RunPhase(Phase& phase, const std::shared_ptr<RouterNav>& router, size_t& frame, size_t warmup, size_t frames, int width, int height)
+{
+    for (size_t i = 0; i < warmup; i++) {
+        RenderFrame(router, frame++, width, height);
+    }
+
+    phase.samples.reserve(frames);
+    for (size_t i = 0; i < frames; i++) {
+        phase.samples.push_back(RenderFrame(router, frame++, width, height));
+    }
+}
+
+double Percentile(std::vector<double> values, double fraction)
+{
+    std::sort(values.begin(), values.end());
+    const size_t index = static_cast<size_t>(fraction * static_cast<double>(values.size() - 1) + 0.5);
+    return values[std::min(index, values.size() - 1)];
+}
+
+void PrintPhase(const Phase& phase)
+{
+    std::vector<double> build, total;
+    int vertices = 0, indices = 0, commands = 0;
+    for (const FrameSample& sample : phase.samples) {
+        build.push_back(sample.buildMs);
+        total.push_back(sample.totalMs);
+        vertices = std::max(vertices, sample.vertices);
+        indices = std::max(indices, sample.indices);
+        commands = std::max(commands, sample.commands);
+    }
+
+    std::printf("[bench] %-20s %8.3f %8.3f %8.3f %8.3f %8.3f %9d %9d %6d\n", phase.name, Percentile(build, 0.5), Percentile(total, 0.5), Percentile(total, 0.9), Percentile(total, 0.99),
+                *std::max_element(total.begin(), total.end()), vertices, indices, commands);
+}
+
+size_t ParseCount(const char* arg, const char* prefix, size_t fallback)
+{
+    const size_t length = std::strlen(prefix);
+    return std::strncmp(arg, prefix, length) == 0 ? std::strtoul(arg + length, nullptr, 10) : fallback;
+}
+} // namespace
+
+int main(int argc, char** argv)
+{
+    size_t frames = 300, warmup = 60;
+    float scale = 1.0f;
+    for (int i = 1; i < argc; i++) {
+        frames = ParseCount(argv[i], "--frames=", frames);
+        warmup = ParseCount(argv[i], "--warmup=", warmup);
+        if (std::strncmp(argv[i], "--scale=", 8) == 0) {
+            scale = std::strtof(argv[i] + 8, nullptr);
+        }
+    }
+    frames = std::max<size_t>(frames, 1);
+    scale = std::clamp(scale, 0.5f, 4.0f);
+
+    const int width = static_cast<int>(static_cast<float>(WINDOW_WIDTH) * scale);
+    const int height = static_cast<int>(static_cast<float>(WINDOW_HEIGHT) * scale);
+
+    OffscreenContext offscreen;
+    if (!CreateOffscreenContext(offscreen, width, height)) {
+        return 1;
+    }
+
+    IMGUI_CHECKVERSION();
+    ImGui::CreateContext();
+    ImGui::GetIO().IniFilename = nullptr;
+
+    Locale::Initialize();
+
+    /** There is no window to ask for a content scale, so SetupImGuiScaling() keeps whatever is set here */
+    XDPI = YDPI = scale;
+    SetupImGuiScaling(nullptr);
+    LoadTextures();
+    ImGui_ImplOpenGL3_Init("#version 130");
+
+    /** Enough release state for the install prompt to draw its version and size lines */
+    selectedRelease = { { "tag_name", "v2.30.0" } };
+    osReleaseInfo = { { "name", "millennium-v2.30.0-linux-x86_64.tar.gz" }, { "size", 33554432 } };
+
+    Phase phases[] = { { "home" }, { "install prompt" }, { "installer" }, { "uninstall select" } };
+    size_t frame = 0;
+
+    /** The same component lists RenderHome() hands the router when Install or Remove is chosen */
+    auto router = std::make_shared<RouterNav>(std::vector<Component>{ RenderHome, RenderInstallPrompt, RenderInstaller });
+    RunPhase(phases[0], router, frame, warmup, frames, width, height);
+
+    router->navigateNext();
+    RunPhase(phases[1], router, frame, warmup, frames, width, height);
+
+    router->navigateNext();
+    RunPhase(phases[2], router, frame, warmup, frames, width, height);
+
+    InitializeUninstaller();
+    router = std::make_shared<RouterNav>(std::vector<Component>{ RenderHome, RenderUninstallSelect });
+    router->navigateNext();
+    RunPhase(phases[3], router, frame, warmup, frames, width, height);
+
+    std::printf("[bench] %zu frames per route after %zu warm-up frames, %dx%d\n", frames, warmup, width, height);
+    std::printf("[bench] %-20s %8s %8s %8s %8s %8s %9s %9s %6s\n", "route", "cpu p50", "p50 ms", "p90 ms", "p99 ms", "max ms", "max vtx", "max idx", "cmds");
+    for (const Phase& phase : phases) {
+        PrintPhase(phase);
+    }
+
+    ImGui_ImplOpenGL3_Shutdown();
+    ImGui::DestroyContext();
+    DestroyOffscreenContext(offscreen);
+    return 0;
+}
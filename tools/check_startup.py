@@ -0,0 +1,149 @@
+#!/usr/bin/env python3
+"""
+Time-to-first-frame benchmark for the Installer.
+
+Launches the installer repeatedly with --startup-benchmark=<file>, which makes it
+write its startup breakdown (see src/include/startup_profile.h) and exit as soon
+as the first frame is shown. Reports the median of every phase and fails when
+the median time to first frame regresses past the baseline.
+
+Runs share a private XDG_CACHE_HOME, and a warm-up run fills the font glyph
+cache first, so the numbers reflect a normal (second and later) launch. Pass
+--cold to give every run an empty cache instead.
+
+Needs a display; in CI it runs under xvfb-run with Mesa's software renderer:
+
+  xvfb-run -a python tools/check_startup.py build/Installer
+  python tools/check_startup.py build/Installer --update    # accept new numbers
+
+Absolute timings only mean something on the machine that took them, so CI
+does not compare against a committed number. It builds the base revision on
+the same runner, records that as the baseline with --update, and then checks
+the new build against it:
+
+  python tools/check_startup.py base/build/Installer --baseline base.json --update
+  python tools/check_startup.py build/Installer --baseline base.json
+
+tools/startup_baseline.json is the default for local runs. It only carries
+the tolerance until someone records their own machine's numbers into it.
+
+Baseline format:
+
+  ttff_ms     median time to first frame the build is held to
+  tolerance   allowed regression as a fraction of ttff_ms
+  phases      median duration of each phase when the baseline was taken
+"""
+
+import argparse
+import json
+import os
+import statistics
+import subprocess
+import sys
+import tempfile
+
+DEFAULT_BASELINE = os.path.join(os.path.dirname(os.path.abspath(__file__)), "startup_baseline.json")
+
+
+def run_once(binary, report_path, cache_dir, timeout):
+    env = dict(os.environ, XDG_CACHE_HOME=cache_dir)
+    if os.path.exists(report_path):
+        os.remove(report_path)
+
+    result = subprocess.run([binary, f"--startup-benchmark={report_path}"], env=env, timeout=timeout,
+                            stdout=subprocess.PIPE, stderr=subprocess.STDOUT, text=True)
+    if result.returncode != 0 or not os.path.exists(report_path):
+        sys.stderr.write(result.stdout)
+        raise RuntimeError(f"installer exited with {result.returncode} without writing a startup report")
+
+    with open(report_path) as f:
+        return json.load(f)
+
+
+def phase_key(phase):
+    return ("  " * phase["depth"]) + phase["name"]
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Fail when the installer's time to first frame regresses.")
+    parser.add_argument("binary", help="path to the Installer executable")
+    parser.add_argument("--runs", type=int, default=7, help="measured launches; the median is compared")
+    parser.add_argument("--baseline", default=DEFAULT_BASELINE)
+    parser.add_argument("--tolerance", type=float, help="override the baseline's allowed regression fraction")
+    parser.add_argument("--cold", action="store_true", help="start every run with an empty cache")
+    parser.add_argument("--timeout", type=float, default=60.0, help="seconds before a launch is considered hung")
+    parser.add_argument("--output", help="also write the median breakdown here as JSON")
+    parser.add_argument("--update", action="store_true", help="write the measured medians as the new baseline")
+    args = parser.parse_args()
+
+    reports = []
+    with tempfile.TemporaryDirectory() as work_dir:
+        report_path = os.path.join(work_dir, "startup.json")
+        shared_cache = os.path.join(work_dir, "cache")
+
+        if not args.cold:
+            run_once(args.binary, report_path, shared_cache, args.timeout)
+
+        for index in range(args.runs):
+            cache_dir = os.path.join(work_dir, f"cache-{index}") if args.cold else shared_cache
+            report = run_once(args.binary, report_path, cache_dir, args.timeout)
+            reports.append(report)
+            print(f"run {index + 1}/{args.runs}: {report['ttff_ms']:.1f} ms")
+
+    ttff = statistics.median(r["ttff_ms"] for r in reports)
+
+    # Phases keep the order of the first report; nesting is shown by indentation
+    durations = {}
+    for report in reports:
+        for phase in report["phases"]:
+            durations.setdefault(phase_key(phase), []).append(phase["duration_ms"])
+    phases = {key: statistics.median(values) for key, values in durations.items()}
+
+    baseline = {}
+    if os.path.exists(args.baseline):
+        with open(args.baseline) as f:
+            baseline = json.load(f)
+    baseline_phases = baseline.get("phases", {})
+
+    print()
+    print(f"{'phase':<40} {'median':>10} {'baseline':>10}")
+    for key, value in phases.items():
+        previous = baseline_phases.get(key)
+        previous_text = f"{previous:.1f} ms" if previous is not None else "-"
+        print(f"{key:<40} {value:>7.1f} ms {previous_text:>10}")
+    print(f"{'time to first frame':<40} {ttff:>7.1f} ms {baseline.get('ttff_ms', 0):>7.1f} ms")
+
+    if args.output:
+        with open(args.output, "w") as f:
+            json.dump({"ttff_ms": ttff, "runs": [r["ttff_ms"] for r in reports], "phases": phases}, f, indent=2)
+
+    if args.update:
+        tolerance = args.tolerance if args.tolerance is not None else baseline.get("tolerance", 0.25)
+        with open(args.baseline, "w") as f:
+            json.dump({"ttff_ms": round(ttff, 1), "tolerance": tolerance,
+                       "phases": {key: round(value, 1) for key, value in phases.items()}}, f, indent=2)
+            f.write("\n")
+        print(f"\nBaseline updated: {args.baseline}")
+        return 0
+
+    if "ttff_ms" not in baseline:
+        print("\nNo baseline to compare against; run with --update to record one.")
+        return 0
+
+    tolerance = args.tolerance if args.tolerance is not None else baseline.get("tolerance", 0.25)
+    limit = baseline["ttff_ms"] * (1.0 + tolerance)
+    if ttff > limit:
+        print(f"\nFAIL: time to first frame {ttff:.1f} ms exceeds {limit:.1f} ms "
+              f"(baseline {baseline['ttff_ms']:.1f} ms + {tolerance:.0%})")
+        regressions = sorted(((value - baseline_phases[key], key) for key, value in phases.items() if key in baseline_phases), reverse=True)
+        for delta, key in regressions[:3]:
+            if delta > 0:
+                print(f"  {key.strip()}: +{delta:.1f} ms")
+        return 1
+
+    print(f"\nOK: time to first frame {ttff:.1f} ms is within {limit:.1f} ms")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,337 @@
+/**
+ * ==================================================
+ *   _____ _ _ _             _
+ *  |     |_| | |___ ___ ___|_|_ _ _____
+ *  | | | | | | | -_|   |   | | | |     |
+ *  |_|_|_|_|_|_|___|_|_|_|_|_|___|_|_|_|
+ *
+ * ==================================================
+ *
+ * Copyright (c) 2025 Project Millennium
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * Build-time asset embedder. Reads the files under resources/static once, on the build machine,
+ * and writes a single translation unit holding every asset, so each is linked exactly once.
+ *
+ *   --font  Name=path   raw file bytes, zlib-compressed; inflated on first use at runtime
+ *   --image Name=path   PNG decoded to RGBA8 here, then zlib-compressed
+ *   --icon  name=path   PNG decoded and packed into the icon atlas
+ *   --atlas Name        the packed icon atlas, stored uncompressed so startup uploads it directly
+ *
+ * Entries are emitted in argument order, which must match Assets::Id in assets.h; the generated
+ * source asserts it. Alongside assets.cc it writes icon_atlas.h with each icon's rectangle.
+ *
+ * Usage: embed_assets <output dir> [--font|--image|--icon Name=path | --atlas Name]...
+ */
+
+#define STB_IMAGE_IMPLEMENTATION
+#include <stb_image.h>
+#include <zlib.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <numeric>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+namespace
+{
+/** Transparent border kept around every icon so linear filtering never samples a neighbour. */
+constexpr int ICON_PADDING = 1;
+
+struct Asset
+{
+    std::string name;
+    std::vector<unsigned char> bytes;
+    int width = 0, height = 0;
+    bool compress = true;
+};
+
+struct Icon
+{
+    std::string name;
+    int width = 0, height = 0;
+    int x = 0, y = 0;
+    std::vector<unsigned char> pixels;
+};
+
+bool ReadFile(const fs::path& path, std::vector<unsigned char>& out)
+{
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        return false;
+    }
+    out.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    return true;
+}
+
+bool DecodePng(const fs::path& path, std::vector<unsigned char>& pixels, int& width, int& height)
+{
+    std::vector<unsigned char> encoded;
+    if (!ReadFile(path, encoded)) {
+        std::cerr << "embed_assets: failed to read " << path.string() << std::endl;
+        return false;
+    }
+
+    unsigned char* decoded = stbi_load_from_memory(encoded.data(), (int)encoded.size(), &width, &height, nullptr, 4);
+    if (!decoded) {
+        std::cerr << "embed_assets: failed to decode " << path.string() << ": " << stbi_failure_reason() << std::endl;
+        return false;
+    }
+    pixels.assign(decoded, decoded + (size_t)width * height * 4);
+    stbi_image_free(decoded);
+    return true;
+}
+
+/**
+ * Place the icons on shelves, tallest first, in an atlas of the given width.
+ * @return The atlas height, or 0 if an icon does not fit the width.
+ */
+int PackShelves(std::vector<Icon>& icons, const std::vector<size_t>& order, int atlasWidth)
+{
+    int cursorX = 0, cursorY = 0, shelfHeight = 0;
+    for (size_t index : order) {
+        Icon& icon = icons[index];
+        const int paddedWidth = icon.width + ICON_PADDING * 2;
+        const int paddedHeight = icon.height + ICON_PADDING * 2;
+
+        if (paddedWidth > atlasWidth) {
+            return 0;
+        }
+        if (cursorX + paddedWidth > atlasWidth) {
+            cursorX = 0;
+            cursorY += shelfHeight;
+            shelfHeight = 0;
+        }
+
+        icon.x = cursorX + ICON_PADDING;
+        icon.y = cursorY + ICON_PADDING;
+        cursorX += paddedWidth;
+        shelfHeight = std::max(shelfHeight, paddedHeight);
+    }
+    return cursorY + shelfHeight;
+}
+
+bool PackAtlas(std::vector<Icon>& icons, Asset& atlas)
+{
+    std::vector<size_t> order(icons.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) { return icons[a].height > icons[b].height; });
+
+    /** Try each power of two width and keep whichever wastes the least area. */
+    for (int width = 64; width <= 2048; width *= 2) {
+        const int height = PackShelves(icons, order, width);
+        if (height > 0 && (atlas.width == 0 || width * height < atlas.width * atlas.height)) {
+            atlas.width = width;
+            atlas.height = height;
+        }
+    }
+    if (atlas.width == 0) {
+        std::cerr << "embed_assets: icons do not fit a 2048 pixel wide atlas" << std::endl;
+        return false;
+    }
+    PackShelves(icons, order, atlas.width);
+
+    atlas.bytes.assign((size_t)atlas.width * atlas.height * 4, 0);
+    for (const Icon& icon : icons) {
+        for (int row = 0; row < icon.height; row++) {
+            std::copy_n(&icon.pixels[(size_t)row * icon.width * 4], (size_t)icon.width * 4, &atlas.bytes[((size_t)(icon.y + row) * atlas.width + icon.x) * 4]);
+        }
+    }
+    atlas.compress = false;
+    return true;
+}
+
+/** zlib-compress, keeping the original bytes when compression does not pay for itself. */
+std::vector<unsigned char> Compress(const Asset& asset, bool& compressed)
+{
+    compressed = false;
+    if (!asset.compress || asset.bytes.empty()) {
+        return asset.bytes;
+    }
+
+    uLongf length = compressBound((uLong)asset.bytes.size());
+    std::vector<unsigned char> out(length);
+    if (compress2(out.data(), &length, asset.bytes.data(), (uLong)asset.bytes.size(), Z_BEST_COMPRESSION) != Z_OK || length >= asset.bytes.size()) {
+        return asset.bytes;
+    }
+    out.resize(length);
+    compressed = true;
+    return out;
+}
+
+void WriteBytes(std::ostream& out, const std::vector<unsigned char>& bytes)
+{
+    char hex[8];
+    for (size_t i = 0; i < bytes.size(); i++) {
+        std::snprintf(hex, sizeof(hex), "0x%02X,", bytes[i]);
+        out << (i % 32 == 0 ? "    " : "") << hex << (i % 32 == 31 ? "\n" : "");
+    }
+    if (bytes.size() % 32 != 0) {
+        out << "\n";
+    }
+}
+
+bool WriteFile(const fs::path& path, const std::string& content)
+{
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file.write(content.data(), (std::streamsize)content.size())) {
+        std::cerr << "embed_assets: failed to write " << path.string() << std::endl;
+        return false;
+    }
+    return true;
+}
+} // namespace
+
+int main(int argc, char** argv)
+{
+    if (argc < 2) {
+        std::cerr << "usage: embed_assets <output dir> [--font|--image|--icon Name=path | --atlas Name]..." << std::endl;
+        return 1;
+    }
+
+    const fs::path outputDir = argv[1];
+    std::vector<Asset> assets;
+    std::vector<Icon> icons;
+    bool atlasPacked = false;
+
+    for (int i = 2; i < argc; i += 2) {
+        const std::string kind = argv[i];
+        if (i + 1 >= argc) {
+            std::cerr << "embed_assets: " << kind << " needs an argument" << std::endl;
+            return 1;
+        }
+
+        const std::string argument = argv[i + 1];
+        const size_t separator = argument.find('=');
+        const std::string name = argument.substr(0, separator);
+        const fs::path path = separator == std::string::npos ? fs::path() : fs::path(argument.substr(separator + 1));
+
+        if (kind == "--atlas") {
+            if (atlasPacked || icons.empty()) {
+                std::cerr << "embed_assets: --atlas must follow the icons, once" << std::endl;
+                return 1;
+            }
+            Asset atlas{ name };
+            if (!PackAtlas(icons, atlas)) {
+                return 1;
+            }
+            assets.push_back(std::move(atlas));
+            atlasPacked = true;
+            continue;
+        }
+
+        if (path.empty()) {
+            std::cerr << "embed_assets: expected Name=path, got " << argument << std::endl;
+            return 1;
+        }
+
+        if (kind == "--font") {
+            Asset asset{ name };
+            if (!ReadFile(path, asset.bytes)) {
+                std::cerr << "embed_assets: failed to read " << path.string() << std::endl;
+                return 1;
+            }
+            assets.push_back(std::move(asset));
+        }
+        else if (kind == "--image") {
+            Asset asset{ name };
+            if (!DecodePng(path, asset.bytes, asset.width, asset.height)) {
+                return 1;
+            }
+            assets.push_back(std::move(asset));
+        }
+        else if (kind == "--icon") {
+            Icon icon{ name };
+            if (!DecodePng(path, icon.pixels, icon.width, icon.height)) {
+                return 1;
+            }
+            icons.push_back(std::move(icon));
+        }
+        else {
+            std::cerr << "embed_assets: unknown option " << kind << std::endl;
+            return 1;
+        }
+    }
+
+    if (!icons.empty() && !atlasPacked) {
+        std::cerr << "embed_assets: icons given without --atlas" << std::endl;
+        return 1;
+    }
+
+    std::ostringstream source;
+    source << "// Auto-generated by embed_assets — do not edit. Rebuilt whenever an asset changes.\n"
+           << "#include <assets.h>\n\n"
+           << "static_assert((size_t)Assets::Id::Count == " << assets.size() << ", \"embed_assets arguments are out of sync with Assets::Id\");\n";
+    for (size_t i = 0; i < assets.size(); i++) {
+        source << "static_assert((size_t)Assets::Id::" << assets[i].name << " == " << i << ");\n";
+    }
+    source << "\nnamespace\n{\n";
+
+    size_t totalSize = 0, totalStored = 0;
+    std::vector<bool> compressed(assets.size());
+    for (size_t i = 0; i < assets.size(); i++) {
+        bool isCompressed = false;
+        const std::vector<unsigned char> stored = Compress(assets[i], isCompressed);
+        compressed[i] = isCompressed;
+        totalSize += assets[i].bytes.size();
+        totalStored += stored.size();
+
+        source << "alignas(16) const unsigned char k" << assets[i].name << "[] = {\n";
+        WriteBytes(source, stored);
+        source << "};\n\n";
+
+        std::cout << "[embed_assets] " << assets[i].name << ": " << assets[i].bytes.size() << " -> " << stored.size() << " bytes" << (isCompressed ? " (zlib)" : "") << std::endl;
+    }
+
+    source << "} // namespace\n\n"
+           << "const Assets::Embedded Assets::EMBEDDED[] = {\n";
+    for (size_t i = 0; i < assets.size(); i++) {
+        source << "    { k" << assets[i].name << ", sizeof(k" << assets[i].name << "), " << assets[i].bytes.size() << ", " << assets[i].width << ", " << assets[i].height << ", "
+               << (compressed[i] ? "true" : "false") << " },\n";
+    }
+    source << "};\n";
+
+    std::ostringstream header;
+    header << "// Auto-generated by embed_assets — do not edit. Rebuilt whenever an icon changes.\n"
+           << "#pragma once\n\n"
+           << "/** { x, y, width, height } in pixels within the icon atlas, indexed by Icon. */\n"
+           << "inline constexpr int kIconAtlasRects[][4] = {\n";
+    for (const Icon& icon : icons) {
+        header << "    { " << icon.x << ", " << icon.y << ", " << icon.width << ", " << icon.height << " }, // " << icon.name << "\n";
+    }
+    header << "};\n";
+
+    if (!WriteFile(outputDir / "assets.cc", source.str()) || !WriteFile(outputDir / "icon_atlas.h", header.str())) {
+        return 1;
+    }
+
+    std::cout << "[embed_assets] " << assets.size() << " assets, " << totalSize << " bytes -> " << totalStored << " embedded" << std::endl;
+    return 0;
+}
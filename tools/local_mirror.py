@@ -0,0 +1,310 @@
+#!/usr/bin/env python3
+"""
+Minimal local release mirror for the Installer.
+
+Serves the small slice of the GitHub REST API the installer uses, plus the
+release assets themselves, from a directory on disk. Point the installer at it
+to test and benchmark downloads, resume and pagination offline and
+reproducibly:
+
+  Installer --release-source=http://127.0.0.1:8080
+  Installer --headless --release-source=http://127.0.0.1:8080 --steam-path /tmp/steam --trace
+
+Layout of --root (the same paths GitHub uses for asset downloads):
+
+  <root>/<owner>/<repo>/releases/download/<tag>/<asset>
+
+Endpoints:
+
+  GET /repos/<owner>/<repo>/releases?per_page=N&page=P
+      Release list synthesized from the tag directories, newest first, with
+      sha256 digests and a GitHub style Link header.
+  GET /<owner>/<repo>/releases/download/<tag>/<asset>
+      The asset itself. Honours single Range requests (206) so interrupted
+      downloads can resume.
+
+Shaping, to make benchmarks meaningful on loopback:
+
+  --latency MS        delay before the first byte of every response
+  --rate BYTES        throttle asset bodies to BYTES per second
+  --drop-after BYTES  close the connection after BYTES of an asset body, once
+                      per asset, to exercise resume
+
+--generate N creates N synthetic Millennium releases under --root, each with a
+windows and linux asset of --asset-size bytes and an .installsize file. The
+asset payload is always a zip archive, since that is what the extractor reads.
+
+Usage:
+  python tools/local_mirror.py --root /tmp/mirror --generate 150
+  python tools/local_mirror.py --root /tmp/mirror --port 8080 --rate 5000000
+"""
+
+import argparse
+import hashlib
+import io
+import json
+import os
+import random
+import re
+import sys
+import threading
+import time
+import zipfile
+from datetime import datetime, timezone
+from http.server import BaseHTTPRequestHandler, ThreadingHTTPServer
+from urllib.parse import parse_qs, urlparse
+
+CHUNK_SIZE = 64 * 1024
+
+digest_cache = {}
+digest_lock = threading.Lock()
+dropped_assets = set()
+
+
+def file_digest(path):
+    stat = os.stat(path)
+    key = (path, stat.st_size, stat.st_mtime_ns)
+
+    with digest_lock:
+        if key in digest_cache:
+            return digest_cache[key]
+
+    sha = hashlib.sha256()
+    with open(path, "rb") as f:
+        for chunk in iter(lambda: f.read(1 << 20), b""):
+            sha.update(chunk)
+
+    with digest_lock:
+        digest_cache[key] = sha.hexdigest()
+    return digest_cache[key]
+
+
+def list_releases(root, owner, repo, base_url):
+    download_dir = os.path.join(root, owner, repo, "releases", "download")
+    if not os.path.isdir(download_dir):
+        return []
+
+    tags = [t for t in os.listdir(download_dir) if os.path.isdir(os.path.join(download_dir, t))]
+    tags.sort(key=lambda t: os.stat(os.path.join(download_dir, t)).st_mtime, reverse=True)
+
+    releases = []
+    for index, tag in enumerate(tags):
+        tag_dir = os.path.join(download_dir, tag)
+        assets = []
+        for asset_index, name in enumerate(sorted(os.listdir(tag_dir))):
+            path = os.path.join(tag_dir, name)
+            if not os.path.isfile(path):
+                continue
+            assets.append({
+                "id": index * 100 + asset_index,
+                "name": name,
+                "size": os.path.getsize(path),
+                "digest": "sha256:" + file_digest(path),
+                "browser_download_url": f"{base_url}/{owner}/{repo}/releases/download/{tag}/{name}",
+            })
+
+        published = datetime.fromtimestamp(os.stat(tag_dir).st_mtime, tz=timezone.utc)
+        releases.append({
+            "id": index,
+            "tag_name": tag,
+            "name": tag,
+            "prerelease": False,
+            "draft": False,
+            "published_at": published.strftime("%Y-%m-%dT%H:%M:%SZ"),
+            "html_url": f"{base_url}/{owner}/{repo}/releases/tag/{tag}",
+            "assets": assets,
+        })
+    return releases
+
+
+class MirrorHandler(BaseHTTPRequestHandler):
+    protocol_version = "HTTP/1.1"
+    server_version = "LocalMirror/1.0"
+
+    def log_message(self, fmt, *args):
+        if not self.server.quiet:
+            sys.stderr.write("[mirror] " + (fmt % args) + "\n")
+
+    def base_url(self):
+        return f"http://{self.headers.get('Host', '%s:%d' % self.server.server_address[:2])}"
+
+    def send_json(self, status, payload, extra_headers=None):
+        body = json.dumps(payload).encode()
+        self.send_response(status)
+        self.send_header("Content-Type", "application/json; charset=utf-8")
+        self.send_header("Content-Length", str(len(body)))
+        for key, value in (extra_headers or {}).items():
+            self.send_header(key, value)
+        self.end_headers()
+        self.wfile.write(body)
+
+    def do_GET(self):
+        if self.server.latency > 0:
+            time.sleep(self.server.latency / 1000.0)
+
+        url = urlparse(self.path)
+
+        api = re.fullmatch(r"/repos/([^/]+)/([^/]+)/releases", url.path)
+        if api:
+            return self.serve_releases(api.group(1), api.group(2), parse_qs(url.query))
+
+        asset = re.fullmatch(r"/([^/]+)/([^/]+)/releases/download/([^/]+)/([^/]+)", url.path)
+        if asset:
+            return self.serve_asset(*asset.groups())
+
+        self.send_json(404, {"message": "Not Found"})
+
+    def serve_releases(self, owner, repo, query):
+        per_page = max(1, min(100, int(query.get("per_page", ["30"])[0])))
+        page = max(1, int(query.get("page", ["1"])[0]))
+
+        releases = list_releases(self.server.root, owner, repo, self.base_url())
+        last_page = max(1, (len(releases) + per_page - 1) // per_page)
+        start = (page - 1) * per_page
+
+        links = []
+        link_base = f"{self.base_url()}/repos/{owner}/{repo}/releases?per_page={per_page}"
+        if page < last_page:
+            links.append(f'<{link_base}&page={page + 1}>; rel="next"')
+            links.append(f'<{link_base}&page={last_page}>; rel="last"')
+        if page > 1:
+            links.append(f'<{link_base}&page={page - 1}>; rel="prev"')
+            links.append(f'<{link_base}&page=1>; rel="first"')
+
+        self.send_json(200, releases[start:start + per_page], {"Link": ", ".join(links)} if links else None)
+
+    def serve_asset(self, owner, repo, tag, name):
+        path = os.path.join(self.server.root, owner, repo, "releases", "download", tag, name)
+        if not os.path.isfile(path):
+            return self.send_json(404, {"message": "Not Found"})
+
+        size = os.path.getsize(path)
+        start, end = 0, size - 1
+
+        range_header = self.headers.get("Range")
+        if range_header:
+            match = re.fullmatch(r"bytes=(\d*)-(\d*)", range_header.strip())
+            if not match or (not match.group(1) and not match.group(2)):
+                self.send_response(416)
+                self.send_header("Content-Range", f"bytes */{size}")
+                self.send_header("Content-Length", "0")
+                self.end_headers()
+                return
+            if match.group(1):
+                start = int(match.group(1))
+                end = int(match.group(2)) if match.group(2) else size - 1
+            else:
+                start = max(0, size - int(match.group(2)))
+            end = min(end, size - 1)
+            if start > end:
+                self.send_response(416)
+                self.send_header("Content-Range", f"bytes */{size}")
+                self.send_header("Content-Length", "0")
+                self.end_headers()
+                return
+
+        self.send_response(206 if range_header else 200)
+        self.send_header("Content-Type", "application/octet-stream")
+        self.send_header("Accept-Ranges", "bytes")
+        self.send_header("Content-Length", str(end - start + 1))
+        if range_header:
+            self.send_header("Content-Range", f"bytes {start}-{end}/{size}")
+        self.end_headers()
+
+        drop_after = None
+        if self.server.drop_after and path not in dropped_assets:
+            dropped_assets.add(path)
+            drop_after = self.server.drop_after
+
+        sent = 0
+        window_start = time.monotonic()
+        with open(path, "rb") as f:
+            f.seek(start)
+            remaining = end - start + 1
+            while remaining > 0:
+                chunk = f.read(min(CHUNK_SIZE, remaining))
+                if not chunk:
+                    break
+
+                if drop_after is not None and sent + len(chunk) > drop_after:
+                    self.wfile.write(chunk[:max(0, drop_after - sent)])
+                    self.wfile.flush()
+                    self.close_connection = True
+                    self.log_message("dropped %s after %d bytes", name, drop_after)
+                    return
+
+                self.wfile.write(chunk)
+                sent += len(chunk)
+                remaining -= len(chunk)
+
+                if self.server.rate > 0:
+                    expected = sent / self.server.rate
+                    elapsed = time.monotonic() - window_start
+                    if expected > elapsed:
+                        time.sleep(expected - elapsed)
+
+
+def generate_releases(root, count, asset_size):
+    download_dir = os.path.join(root, "SteamClientHomebrew", "Millennium", "releases", "download")
+    rng = random.Random(0)
+    now = time.time()
+
+    for i in range(count):
+        tag = f"v{2 + i // 100}.{(i // 10) % 10}.{i % 10}"
+        tag_dir = os.path.join(download_dir, tag)
+        os.makedirs(tag_dir, exist_ok=True)
+
+        # Incompressible payload so throughput numbers reflect the wire, not deflate
+        buffer = io.BytesIO()
+        with zipfile.ZipFile(buffer, "w", zipfile.ZIP_STORED) as archive:
+            archive.writestr("millennium/version.txt", tag + "\n")
+            archive.writestr("millennium/payload.bin", rng.randbytes(max(0, asset_size - 512)))
+        payload = buffer.getvalue()
+
+        for platform_name, extension in (("windows", "zip"), ("linux", "tar.gz")):
+            with open(os.path.join(tag_dir, f"millennium-{tag}-{platform_name}-x86_64.{extension}"), "wb") as f:
+                f.write(payload)
+            with open(os.path.join(tag_dir, f"millennium-{tag}-{platform_name}-x86_64.installsize"), "w") as f:
+                f.write(f"{len(payload) / (1024 * 1024):.1f} MB\n")
+
+        # Older releases get older timestamps, so the newest tag is listed first
+        timestamp = now - (count - i)
+        os.utime(tag_dir, (timestamp, timestamp))
+
+    print(f"Generated {count} releases under {download_dir}")
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Serve Installer releases from a local directory.")
+    parser.add_argument("--root", required=True, help="mirror directory")
+    parser.add_argument("--host", default="127.0.0.1")
+    parser.add_argument("--port", type=int, default=8080)
+    parser.add_argument("--latency", type=float, default=0, help="milliseconds before the first byte of each response")
+    parser.add_argument("--rate", type=int, default=0, help="asset throughput cap in bytes per second")
+    parser.add_argument("--drop-after", type=int, default=0, help="drop each asset's first download after this many bytes")
+    parser.add_argument("--generate", type=int, default=0, help="create this many synthetic releases, then exit")
+    parser.add_argument("--asset-size", type=int, default=32 * 1024 * 1024, help="size of generated assets in bytes")
+    parser.add_argument("--quiet", action="store_true")
+    args = parser.parse_args()
+
+    if args.generate:
+        generate_releases(args.root, args.generate, args.asset_size)
+        return 0
+
+    server = ThreadingHTTPServer((args.host, args.port), MirrorHandler)
+    server.root = os.path.abspath(args.root)
+    server.latency = args.latency
+    server.rate = args.rate
+    server.drop_after = args.drop_after
+    server.quiet = args.quiet
+
+    print(f"Serving {server.root} on http://{args.host}:{args.port}")
+    try:
+        server.serve_forever()
+    except KeyboardInterrupt:
+        pass
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())